@@ -192,7 +192,10 @@ u8 LoadBgVram(u8 bg, const void *src, u16 size, u16 destOffset, u8 mode)
 
         offset = destOffset + offset;
 
-        cursor = RequestDma3Copy(src, (void*)(offset + BG_VRAM), size, 0);
+        if (mode == 0x2)
+            cursor = RequestDma3CopyWithPriority(src, (void*)(offset + BG_VRAM), size, 0, DMA3_PRIORITY_TILEMAP);
+        else
+            cursor = RequestDma3Copy(src, (void*)(offset + BG_VRAM), size, 0);
 
         if (cursor == -1)
         {
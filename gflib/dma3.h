@@ -46,9 +46,27 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+// Requests are sent in this order when several are waiting.
+#define DMA3_PRIORITY_PALETTE 0 // palettes and OAM
+#define DMA3_PRIORITY_TILEMAP 1
+#define DMA3_PRIORITY_TILES   2
+#define DMA3_PRIORITY_COUNT   3
+
+// What ProcessDma3Requests did during the last VBlank.
+struct Dma3Stats
+{
+    u32 bytesTransferred;
+    u32 bytesDeferred; // still queued for the next VBlank
+    u16 requestsCoalesced; // folded into an already queued request
+    u16 requestsDropped; // rejected because the queue was full
+};
+
+extern struct Dma3Stats gDma3Stats;
+
 void ClearDma3Requests(void);
 void ProcessDma3Requests(void);
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode);
+s16 RequestDma3CopyWithPriority(const void *src, void *dest, u16 size, u8 mode, u8 priority);
 s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode);
 s16 CheckForSpaceForDma3Request(s16 index);
 
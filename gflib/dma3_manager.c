@@ -8,24 +8,64 @@
 #define DMA_REQUEST_COPY16 3
 #define DMA_REQUEST_FILL16 4
 
-BSS_DATA struct
+#define IS_FILL_REQUEST(mode) ((mode) == DMA_REQUEST_FILL32 || (mode) == DMA_REQUEST_FILL16)
+
+// Don't transfer more than this per VBlank; the rest waits for the next one.
+#define DMA3_VBLANK_BYTE_BUDGET (40 * 1024)
+
+// EWRAM through OAM. Nothing is ever written below or above them, so reads
+// from BIOS or ROM can't conflict with anything.
+#define DMA3_REGION_COUNT 6
+#define DMA3_REGION(addr) (((u32)(addr) >> 24) - 2)
+
+struct Dma3Request
 {
     const u8 *src;
     u8 *dest;
     u16 size;
-    u16 mode;
+    u8 mode;
+    u8 priority;
     u32 value;
-} gDma3Requests[MAX_DMA_REQUESTS];
+};
+
+BSS_DATA struct Dma3Request gDma3Requests[MAX_DMA_REQUESTS];
 
 static volatile bool8 gDma3ManagerLocked;
 static u8 gDma3RequestCursor;
 
+// Requests are appended at sDma3RequestTail and the queue spans
+// sDma3RequestCount slots from gDma3RequestCursor. Requests that were sent
+// early because of their priority leave free slots inside that span until
+// the cursor moves past them.
+static u8 sDma3RequestTail;
+static u8 sDma3RequestCount;
+static u16 sDma3RequestsCoalesced;
+static u16 sDma3RequestsDropped;
+
+struct Dma3Stats gDma3Stats;
+
+// The bounds, per memory region, of what the requests left in the queue so
+// far this pass write and read. A request may only go ahead of them if it
+// stays clear of these, which costs the same however long the queue is.
+struct Dma3Bounds
+{
+    const u8 *start[DMA3_REGION_COUNT];
+    const u8 *end[DMA3_REGION_COUNT];
+};
+
+static struct Dma3Bounds sDma3SkippedWrites;
+static struct Dma3Bounds sDma3SkippedReads;
+
 void ClearDma3Requests(void)
 {
     int i;
 
     gDma3ManagerLocked = TRUE;
     gDma3RequestCursor = 0;
+    sDma3RequestTail = 0;
+    sDma3RequestCount = 0;
+    sDma3RequestsCoalesced = 0;
+    sDma3RequestsDropped = 0;
 
     for (i = 0; i < MAX_DMA_REQUESTS; i++)
     {
@@ -37,125 +77,314 @@ void ClearDma3Requests(void)
     gDma3ManagerLocked = FALSE;
 }
 
+static bool8 RangesOverlap(const u8 *a, u16 aSize, const u8 *b, u16 bSize)
+{
+    return a < b + bSize && b < a + aSize;
+}
+
+// Whether running later before earlier could change what ends up in memory.
+static bool8 Dma3RequestsConflict(const struct Dma3Request *earlier, const struct Dma3Request *later)
+{
+    if (RangesOverlap(earlier->dest, earlier->size, later->dest, later->size))
+        return TRUE;
+    if (!IS_FILL_REQUEST(later->mode) && RangesOverlap(earlier->dest, earlier->size, later->src, later->size))
+        return TRUE;
+    if (!IS_FILL_REQUEST(earlier->mode) && RangesOverlap(earlier->src, earlier->size, later->dest, later->size))
+        return TRUE;
+    return FALSE;
+}
+
+static u8 GetDma3Priority(const void *dest)
+{
+    u32 addr = (u32)dest;
+
+    if ((addr >= PLTT && addr < PLTT + PLTT_SIZE) || (addr >= OAM && addr < OAM + OAM_SIZE))
+        return DMA3_PRIORITY_PALETTE;
+    return DMA3_PRIORITY_TILES;
+}
+
+static void DoDma3Request(const struct Dma3Request *request)
+{
+    switch (request->mode)
+    {
+    case DMA_REQUEST_COPY32: // regular 32-bit copy
+        Dma3CopyLarge32_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
+        Dma3FillLarge32_(request->value, request->dest, request->size);
+        break;
+    case DMA_REQUEST_COPY16: // regular 16-bit copy
+        Dma3CopyLarge16_(request->src, request->dest, request->size);
+        break;
+    case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
+        Dma3FillLarge16_(request->value, request->dest, request->size);
+        break;
+    }
+}
+
+static void ClearDma3Bounds(struct Dma3Bounds *bounds)
+{
+    u8 i;
+
+    for (i = 0; i < DMA3_REGION_COUNT; i++)
+        bounds->end[i] = NULL;
+}
+
+static void AddToDma3Region(struct Dma3Bounds *bounds, u32 region, const u8 *start, u16 size)
+{
+    if (region >= DMA3_REGION_COUNT)
+        return;
+    if (bounds->end[region] == NULL)
+    {
+        bounds->start[region] = start;
+        bounds->end[region] = start + size;
+    }
+    else
+    {
+        bounds->start[region] = min(bounds->start[region], start);
+        bounds->end[region] = max(bounds->end[region], start + size);
+    }
+}
+
+static bool8 OverlapsDma3Region(const struct Dma3Bounds *bounds, u32 region, const u8 *start, u16 size)
+{
+    return region < DMA3_REGION_COUNT
+        && bounds->end[region] != NULL
+        && start < bounds->end[region]
+        && bounds->start[region] < start + size;
+}
+
+// A range is counted in the regions of both its first and last byte, in
+// case it runs from one into the next.
+static void AddToDma3Bounds(struct Dma3Bounds *bounds, const u8 *start, u16 size)
+{
+    AddToDma3Region(bounds, DMA3_REGION(start), start, size);
+    AddToDma3Region(bounds, DMA3_REGION(start + size - 1), start, size);
+}
+
+static bool8 OverlapsDma3Bounds(const struct Dma3Bounds *bounds, const u8 *start, u16 size)
+{
+    return OverlapsDma3Region(bounds, DMA3_REGION(start), start, size)
+        || OverlapsDma3Region(bounds, DMA3_REGION(start + size - 1), start, size);
+}
+
+static void SkipDma3Request(const struct Dma3Request *request)
+{
+    AddToDma3Bounds(&sDma3SkippedWrites, request->dest, request->size);
+    if (!IS_FILL_REQUEST(request->mode))
+        AddToDma3Bounds(&sDma3SkippedReads, request->src, request->size);
+}
+
+// Whether a request may be sent before the ones skipped so far this pass.
+static bool8 CanSendDma3RequestEarly(const struct Dma3Request *request)
+{
+    if (OverlapsDma3Bounds(&sDma3SkippedWrites, request->dest, request->size))
+        return FALSE;
+    if (OverlapsDma3Bounds(&sDma3SkippedReads, request->dest, request->size))
+        return FALSE;
+    if (!IS_FILL_REQUEST(request->mode) && OverlapsDma3Bounds(&sDma3SkippedWrites, request->src, request->size))
+        return FALSE;
+    return TRUE;
+}
+
+// Palettes and OAM go first, then tilemaps, then tiles. Within a priority
+// class requests stay in the order they were made, and a request is never
+// moved ahead of an earlier one that touches the same memory.
 void ProcessDma3Requests(void)
 {
-    u16 bytesTransferred;
+    u32 bytesTransferred;
+    u32 bytesDeferred;
+    u8 priority;
+    u8 cursor;
+    u8 i;
 
     if (gDma3ManagerLocked)
         return;
 
     bytesTransferred = 0;
 
-    // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (gDma3Requests[gDma3RequestCursor].size != 0)
+    for (priority = 0; priority < DMA3_PRIORITY_COUNT; priority++)
     {
-        bytesTransferred += gDma3Requests[gDma3RequestCursor].size;
+        ClearDma3Bounds(&sDma3SkippedWrites);
+        ClearDma3Bounds(&sDma3SkippedReads);
+        cursor = gDma3RequestCursor;
+        for (i = 0; i < sDma3RequestCount; i++, cursor = (cursor + 1) % MAX_DMA_REQUESTS)
+        {
+            struct Dma3Request *request = &gDma3Requests[cursor];
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+            if (request->size == 0)
+                continue;
+            if (request->priority != priority || !CanSendDma3RequestEarly(request))
+            {
+                SkipDma3Request(request);
+                continue;
+            }
 
-        switch (gDma3Requests[gDma3RequestCursor].mode)
-        {
-        case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
-            break;
-        }
+            if (bytesTransferred != 0 && bytesTransferred + request->size > DMA3_VBLANK_BYTE_BUDGET)
+                goto done;
+            if (*(u8 *)REG_ADDR_VCOUNT > 224)
+                goto done; // we're about to leave vblank, stop
 
-        // Free the request
-        gDma3Requests[gDma3RequestCursor].src = NULL;
-        gDma3Requests[gDma3RequestCursor].dest = NULL;
-        gDma3Requests[gDma3RequestCursor].size = 0;
-        gDma3Requests[gDma3RequestCursor].mode = 0;
-        gDma3Requests[gDma3RequestCursor].value = 0;
-        gDma3RequestCursor++;
+            DoDma3Request(request);
+            bytesTransferred += request->size;
 
-        if (gDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
+            // Free the request
+            request->src = NULL;
+            request->dest = NULL;
+            request->size = 0;
+            request->mode = 0;
+            request->value = 0;
+        }
+    }
+
+done:
+    while (sDma3RequestCount != 0 && gDma3Requests[gDma3RequestCursor].size == 0)
+    {
+        sDma3RequestCount--;
+        if (++gDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
             gDma3RequestCursor = 0;
     }
+
+    bytesDeferred = 0;
+    cursor = gDma3RequestCursor;
+    for (i = 0; i < sDma3RequestCount; i++, cursor = (cursor + 1) % MAX_DMA_REQUESTS)
+        bytesDeferred += gDma3Requests[cursor].size;
+
+    gDma3Stats.bytesTransferred = bytesTransferred;
+    gDma3Stats.bytesDeferred = bytesDeferred;
+    gDma3Stats.requestsCoalesced = sDma3RequestsCoalesced;
+    gDma3Stats.requestsDropped = sDma3RequestsDropped;
+    sDma3RequestsCoalesced = 0;
+    sDma3RequestsDropped = 0;
 }
 
-s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+// Two requests can become one if they are the same kind of transfer and
+// their destinations touch or overlap. Copies must also read from the same
+// buffer at the same offset, and fills must write the same value.
+static bool8 TryMergeDma3Requests(struct Dma3Request *queued, const struct Dma3Request *request, bool8 apply)
 {
-    int cursor;
-    int i = 0;
+    u8 *start;
+    u8 *end;
 
-    gDma3ManagerLocked = TRUE;
-    cursor = gDma3RequestCursor;
-
-    while (i < MAX_DMA_REQUESTS)
+    if (queued->mode != request->mode || queued->priority != request->priority)
+        return FALSE;
+    if (request->dest > queued->dest + queued->size || queued->dest > request->dest + request->size)
+        return FALSE;
+    if (IS_FILL_REQUEST(request->mode))
     {
-        if (gDma3Requests[cursor].size == 0) // an empty request was found.
-        {
-            gDma3Requests[cursor].src = src;
-            gDma3Requests[cursor].dest = dest;
-            gDma3Requests[cursor].size = size;
+        if (queued->value != request->value)
+            return FALSE;
+    }
+    else if (queued->dest - queued->src != request->dest - request->src)
+    {
+        return FALSE;
+    }
 
-            if (mode == 1)
-                gDma3Requests[cursor].mode = DMA_REQUEST_COPY32;
-            else
-                gDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
+    start = min(queued->dest, request->dest);
+    end = max(queued->dest + queued->size, request->dest + request->size);
+    if (end - start > 0xFFFF)
+        return FALSE;
 
-            gDma3ManagerLocked = FALSE;
-            return cursor;
-        }
-        if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
-            cursor = 0;
-        i++;
+    if (apply)
+    {
+        if (!IS_FILL_REQUEST(request->mode))
+            queued->src += start - queued->dest;
+        queued->dest = start;
+        queued->size = end - start;
     }
-    gDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    return TRUE;
 }
 
-s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+static s16 QueueDma3Request(const struct Dma3Request *request)
 {
     int cursor;
-    int i = 0;
+    int i;
+    int target = -1;
 
-    cursor = gDma3RequestCursor;
     gDma3ManagerLocked = TRUE;
 
-    while (i < MAX_DMA_REQUESTS)
+    // Look for a queued request to fold this one into, as long as no request
+    // queued after it touches the same memory.
+    cursor = gDma3RequestCursor;
+    for (i = 0; i < sDma3RequestCount; i++)
     {
-        if (gDma3Requests[cursor].size == 0) // an empty request was found.
+        struct Dma3Request *queued = &gDma3Requests[cursor];
+
+        if (queued->size != 0)
         {
-            gDma3Requests[cursor].dest = dest;
-            gDma3Requests[cursor].size = size;
-            gDma3Requests[cursor].mode = mode;
-            gDma3Requests[cursor].value = value;
-
-            if(mode == 1)
-                gDma3Requests[cursor].mode = DMA_REQUEST_FILL32;
-            else
-                gDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
-
-            gDma3ManagerLocked = FALSE;
-            return cursor;
+            if (TryMergeDma3Requests(queued, request, FALSE))
+                target = cursor;
+            else if (target != -1 && Dma3RequestsConflict(queued, request))
+                target = -1;
         }
         if (++cursor >= MAX_DMA_REQUESTS) // loop back to start.
             cursor = 0;
-        i++;
     }
+
+    if (target != -1)
+    {
+        TryMergeDma3Requests(&gDma3Requests[target], request, TRUE);
+        sDma3RequestsCoalesced++;
+        gDma3ManagerLocked = FALSE;
+        return target;
+    }
+
+    if (sDma3RequestCount >= MAX_DMA_REQUESTS)
+    {
+        sDma3RequestsDropped++;
+        gDma3ManagerLocked = FALSE;
+        return -1;  // no free DMA request was found
+    }
+
+    cursor = sDma3RequestTail;
+    gDma3Requests[cursor] = *request;
+    sDma3RequestCount++;
+    if (++sDma3RequestTail >= MAX_DMA_REQUESTS) // loop back to start.
+        sDma3RequestTail = 0;
+
     gDma3ManagerLocked = FALSE;
-    return -1;  // no free DMA request was found
+    return cursor;
+}
+
+s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
+{
+    return RequestDma3CopyWithPriority(src, dest, size, mode, GetDma3Priority(dest));
+}
+
+s16 RequestDma3CopyWithPriority(const void *src, void *dest, u16 size, u8 mode, u8 priority)
+{
+    struct Dma3Request request;
+
+    request.src = src;
+    request.dest = dest;
+    request.size = size;
+    request.priority = priority;
+    request.value = 0;
+
+    if (mode == 1)
+        request.mode = DMA_REQUEST_COPY32;
+    else
+        request.mode = DMA_REQUEST_COPY16;
+
+    return QueueDma3Request(&request);
+}
+
+s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
+{
+    struct Dma3Request request;
+
+    request.src = NULL;
+    request.dest = dest;
+    request.size = size;
+    request.priority = GetDma3Priority(dest);
+    request.value = value;
+
+    if (mode == 1)
+        request.mode = DMA_REQUEST_FILL32;
+    else
+        request.mode = DMA_REQUEST_FILL16;
+
+    return QueueDma3Request(&request);
 }
 
 s16 CheckForSpaceForDma3Request(s16 index)
@@ -1,4 +1,5 @@
 #include "global.h"
+#include "malloc.h"
 
 static void *sHeapStart;
 static u32 sHeapSize;
@@ -6,6 +7,11 @@ static u32 malloc_c_unused_0300000c; // needed to align dma3_manager.o(.bss)
 
 #define MALLOC_SYSTEM_ID 0xA3A3
 
+// Free blocks are kept in one list per size class. Class n holds blocks of
+// at least 16 << n bytes (class 0 also holds the 8 and 12 byte ones), so any
+// block from a class above the request's class is big enough.
+#define NUM_SIZE_CLASSES 12
+
 struct MemBlock {
     // Whether this block is currently allocated.
     bool16 flag;
@@ -26,6 +32,104 @@ struct MemBlock {
     u8 data[0];
 };
 
+// Stored in the data of free blocks.
+struct FreeListLinks {
+    struct MemBlock *prev;
+    struct MemBlock *next;
+};
+
+#define FREE_LINKS(block) ((struct FreeListLinks *)(block)->data)
+
+// Smallest block data size, so a free block can hold its free list links:
+// 8 bytes on the GBA, 16 in a 64-bit host build.
+#define MIN_BLOCK_SIZE sizeof(struct FreeListLinks)
+
+static struct MemBlock *sFreeLists[NUM_SIZE_CLASSES];
+static u16 sNonEmptyFreeLists;
+static u32 sHeapBytesUsed;
+static u32 sHeapHighWaterMark;
+
+static u8 GetSizeClass(u32 size)
+{
+    u8 sizeClass = 0;
+
+    size >>= 5;
+    while (size != 0 && sizeClass < NUM_SIZE_CLASSES - 1) {
+        size >>= 1;
+        sizeClass++;
+    }
+
+    return sizeClass;
+}
+
+static void AddToFreeList(struct MemBlock *block)
+{
+    u8 sizeClass = GetSizeClass(block->size);
+
+    FREE_LINKS(block)->prev = NULL;
+    FREE_LINKS(block)->next = sFreeLists[sizeClass];
+    if (sFreeLists[sizeClass] != NULL)
+        FREE_LINKS(sFreeLists[sizeClass])->prev = block;
+    sFreeLists[sizeClass] = block;
+    sNonEmptyFreeLists |= 1 << sizeClass;
+}
+
+static void RemoveFromFreeList(struct MemBlock *block)
+{
+    u8 sizeClass = GetSizeClass(block->size);
+    struct FreeListLinks *links = FREE_LINKS(block);
+
+    if (links->prev != NULL)
+        FREE_LINKS(links->prev)->next = links->next;
+    else
+        sFreeLists[sizeClass] = links->next;
+
+    if (links->next != NULL)
+        FREE_LINKS(links->next)->prev = links->prev;
+
+    if (sFreeLists[sizeClass] == NULL)
+        sNonEmptyFreeLists &= ~(1 << sizeClass);
+}
+
+// Returns the smallest free block of at least size bytes from the request's
+// size class, or failing that from the next non-empty class. Taking the best
+// fit keeps large blocks intact about as well as the old first-fit walk did.
+static struct MemBlock *FindFreeBlock(u32 size)
+{
+    u8 sizeClass = GetSizeClass(size);
+    u32 largerLists;
+    struct MemBlock *block;
+    struct MemBlock *best = NULL;
+
+    // Blocks in the request's own class may still be too small.
+    for (block = sFreeLists[sizeClass]; block != NULL; block = FREE_LINKS(block)->next) {
+        if (block->size >= size && (best == NULL || block->size < best->size))
+            best = block;
+    }
+
+    if (best != NULL)
+        return best;
+
+    // Any block in a larger class fits.
+    largerLists = sNonEmptyFreeLists >> (sizeClass + 1);
+    if (largerLists == 0)
+        return NULL;
+
+    sizeClass++;
+    while (!(largerLists & 1)) {
+        largerLists >>= 1;
+        sizeClass++;
+    }
+
+    best = sFreeLists[sizeClass];
+    for (block = FREE_LINKS(best)->next; block != NULL; block = FREE_LINKS(block)->next) {
+        if (block->size < best->size)
+            best = block;
+    }
+
+    return best;
+}
+
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
     struct MemBlock *header = (struct MemBlock *)block;
@@ -44,8 +148,8 @@ void PutFirstMemBlockHeader(void *block, u32 size)
 
 void *AllocInternal(void *heapStart, u32 size)
 {
-    struct MemBlock *pos = (struct MemBlock *)heapStart;
-    struct MemBlock *head = pos;
+    struct MemBlock *head = (struct MemBlock *)heapStart;
+    struct MemBlock *pos;
     struct MemBlock *splitBlock;
     u32 foundBlockSize;
 
@@ -53,45 +157,46 @@ void *AllocInternal(void *heapStart, u32 size)
     if (size & 3)
         size = 4 * ((size / 4) + 1);
 
-    for (;;) {
-        // Loop through the blocks looking for unused block that's big enough.
+    if (size < MIN_BLOCK_SIZE)
+        size = MIN_BLOCK_SIZE;
 
-        if (!pos->flag) {
-            foundBlockSize = pos->size;
+    pos = FindFreeBlock(size);
+    if (pos == NULL)
+        return NULL;
 
-            if (foundBlockSize >= size) {
-                if (foundBlockSize - size < 2 * sizeof(struct MemBlock)) {
-                    // The block isn't much bigger than the requested size,
-                    // so just use it.
-                    pos->flag = TRUE;
-                } else {
-                    // The block is significantly bigger than the requested
-                    // size, so split the rest into a separate block.
-                    foundBlockSize -= sizeof(struct MemBlock);
-                    foundBlockSize -= size;
+    RemoveFromFreeList(pos);
+    foundBlockSize = pos->size;
 
-                    splitBlock = (struct MemBlock *)(pos->data + size);
+    if (foundBlockSize - size < 2 * sizeof(struct MemBlock)) {
+        // The block isn't much bigger than the requested size,
+        // so just use it.
+        pos->flag = TRUE;
+    } else {
+        // The block is significantly bigger than the requested
+        // size, so split the rest into a separate block.
+        foundBlockSize -= sizeof(struct MemBlock);
+        foundBlockSize -= size;
 
-                    pos->flag = TRUE;
-                    pos->size = size;
+        splitBlock = (struct MemBlock *)(pos->data + size);
 
-                    PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+        pos->flag = TRUE;
+        pos->size = size;
 
-                    pos->next = splitBlock;
+        PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
 
-                    if (splitBlock->next != head)
-                        splitBlock->next->prev = splitBlock;
-                }
+        pos->next = splitBlock;
 
-                return pos->data;
-            }
-        }
-
-        if (pos->next == head)
-            return NULL;
+        if (splitBlock->next != head)
+            splitBlock->next->prev = splitBlock;
 
-        pos = pos->next;
+        AddToFreeList(splitBlock);
     }
+
+    sHeapBytesUsed += sizeof(struct MemBlock) + pos->size;
+    if (sHeapBytesUsed > sHeapHighWaterMark)
+        sHeapHighWaterMark = sHeapBytesUsed;
+
+    return pos->data;
 }
 
 void FreeInternal(void *heapStart, void *pointer)
@@ -100,11 +205,13 @@ void FreeInternal(void *heapStart, void *pointer)
         struct MemBlock *head = (struct MemBlock *)heapStart;
         struct MemBlock *block = (struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
         block->flag = FALSE;
+        sHeapBytesUsed -= sizeof(struct MemBlock) + block->size;
 
         // If the freed block isn't the last one, merge with the next block
         // if it's not in use.
         if (block->next != head) {
             if (!block->next->flag) {
+                RemoveFromFreeList(block->next);
                 block->size += sizeof(struct MemBlock) + block->next->size;
                 block->next->magic = 0;
                 block->next = block->next->next;
@@ -117,6 +224,7 @@ void FreeInternal(void *heapStart, void *pointer)
         // if it's not in use.
         if (block != head) {
             if (!block->prev->flag) {
+                RemoveFromFreeList(block->prev);
                 block->prev->next = block->next;
 
                 if (block->next != head)
@@ -124,8 +232,11 @@ void FreeInternal(void *heapStart, void *pointer)
 
                 block->magic = 0;
                 block->prev->size += sizeof(struct MemBlock) + block->size;
+                block = block->prev;
             }
         }
+
+        AddToFreeList(block);
     }
 }
 
@@ -171,9 +282,18 @@ bool32 CheckMemBlockInternal(void *heapStart, void *pointer)
 
 void InitHeap(void *heapStart, u32 heapSize)
 {
+    u8 i;
+
     sHeapStart = heapStart;
     sHeapSize = heapSize;
     PutFirstMemBlockHeader(heapStart, heapSize);
+
+    for (i = 0; i < NUM_SIZE_CLASSES; i++)
+        sFreeLists[i] = NULL;
+    sNonEmptyFreeLists = 0;
+    sHeapBytesUsed = 0;
+    sHeapHighWaterMark = 0;
+    AddToFreeList((struct MemBlock *)heapStart);
 }
 
 void *Alloc(u32 size)
@@ -208,3 +328,90 @@ bool32 CheckHeap()
 
     return TRUE;
 }
+
+void GetHeapStats(struct HeapStats *stats)
+{
+    struct MemBlock *pos = (struct MemBlock *)sHeapStart;
+
+    stats->totalFree = 0;
+    stats->largestFreeBlock = 0;
+    stats->usedBlocks = 0;
+    stats->freeBlocks = 0;
+    stats->bytesUsed = sHeapBytesUsed;
+    stats->highWaterMark = sHeapHighWaterMark;
+
+    do {
+        if (pos->flag) {
+            stats->usedBlocks++;
+        } else {
+            stats->freeBlocks++;
+            stats->totalFree += pos->size;
+            if (pos->size > stats->largestFreeBlock)
+                stats->largestFreeBlock = pos->size;
+        }
+        pos = pos->next;
+    } while (pos != (struct MemBlock *)sHeapStart);
+}
+
+bool32 InitArena(struct Arena *arena, u32 size)
+{
+    arena->base = Alloc(size);
+    arena->size = arena->base != NULL ? size : 0;
+    arena->used = 0;
+    return arena->base != NULL;
+}
+
+void *ArenaAlloc(struct Arena *arena, u32 size)
+{
+    void *mem;
+
+    // Alignment
+    if (size & 3)
+        size = 4 * ((size / 4) + 1);
+
+    if (arena->base == NULL || arena->size - arena->used < size)
+        return NULL;
+
+    mem = arena->base + arena->used;
+    arena->used += size;
+    return mem;
+}
+
+void *ArenaAllocZeroed(struct Arena *arena, u32 size)
+{
+    void *mem = ArenaAlloc(arena, size);
+
+    if (mem != NULL) {
+        if (size & 3)
+            size = 4 * ((size / 4) + 1);
+
+        CpuFill32(0, mem, size);
+    }
+
+    return mem;
+}
+
+// Everything allocated after GetArenaMark is released by ResetArenaToMark.
+u32 GetArenaMark(struct Arena *arena)
+{
+    return arena->used;
+}
+
+void ResetArenaToMark(struct Arena *arena, u32 mark)
+{
+    if (mark < arena->used)
+        arena->used = mark;
+}
+
+void ResetArena(struct Arena *arena)
+{
+    arena->used = 0;
+}
+
+void FreeArena(struct Arena *arena)
+{
+    Free(arena->base);
+    arena->base = NULL;
+    arena->size = 0;
+    arena->used = 0;
+}
@@ -12,11 +12,39 @@
     ptr = NULL;                         \
 }
 
+// All sizes are in bytes. bytesUsed and highWaterMark include block headers.
+struct HeapStats
+{
+    u32 totalFree;
+    u32 largestFreeBlock;
+    u32 bytesUsed;
+    u32 highWaterMark;
+    u16 usedBlocks;
+    u16 freeBlocks;
+};
+
+// One heap block handed out with a bump pointer. Nothing is freed on its
+// own; the whole arena, or everything past a mark, is released at once.
+struct Arena
+{
+    u8 *base;
+    u32 size;
+    u32 used;
+};
+
 extern u8 gHeap[];
 
 void *Alloc(u32 size);
 void *AllocZeroed(u32 size);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
+void GetHeapStats(struct HeapStats *stats);
+bool32 InitArena(struct Arena *arena, u32 size);
+void *ArenaAlloc(struct Arena *arena, u32 size);
+void *ArenaAllocZeroed(struct Arena *arena, u32 size);
+u32 GetArenaMark(struct Arena *arena);
+void ResetArenaToMark(struct Arena *arena, u32 mark);
+void ResetArena(struct Arena *arena);
+void FreeArena(struct Arena *arena);
 
 #endif // GUARD_ALLOC_H
@@ -3,27 +3,25 @@
 #include "main.h"
 #include "palette.h"
 #include "random.h"
+#include "bitset.h"
+#include "frame_budget.h"
+#include "mgba.h"
+#include "trace.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
 #define OAM_MATRIX_COUNT 32
 
+// Twice MAX_SPRITES, so probe runs in the tile tag hash stay short.
+#define TILE_TAG_HASH_BITS 7
+#define TILE_TAG_HASH_SIZE (1 << TILE_TAG_HASH_BITS)
+
 #define SET_SPRITE_TILE_RANGE(index, start, count) \
 {                                                  \
     sSpriteTileRanges[index * 2] = start;          \
     (sSpriteTileRanges + 1)[index * 2] = count;    \
 }
 
-#define ALLOC_SPRITE_TILE(n)                             \
-{                                                        \
-    sSpriteTileAllocBitmap[(n) / 8] |= (1 << ((n) % 8)); \
-}
-
-#define FREE_SPRITE_TILE(n)                               \
-{                                                         \
-    sSpriteTileAllocBitmap[(n) / 8] &= ~(1 << ((n) % 8)); \
-}
-
 #define SPRITE_TILE_IS_ALLOCATED(n) ((sSpriteTileAllocBitmap[(n) / 8] >> ((n) % 8)) & 1)
 
 
@@ -49,6 +47,7 @@ static u8 CreateSpriteAt(u8 index, const struct SpriteTemplate *template, s16 x,
 static void ResetOamMatrices(void);
 static void ResetSprite(struct Sprite *sprite);
 static s16 AllocSpriteTiles(u16 tileCount);
+static s16 FindFreeSpriteTiles(u16 first, u16 tileCount, bool8 bestFit);
 static void RequestSpriteFrameImageCopy(u16 index, u16 tileNum, const struct SpriteFrameImage *images);
 static void ResetAllSprites(void);
 static void BeginAnim(struct Sprite *sprite);
@@ -84,6 +83,8 @@ static s16 ConvertScaleParam(s16 scale);
 static void GetAffineAnimFrame(u8 matrixNum, struct Sprite *sprite, struct AffineAnimFrameCmd *frameCmd);
 static void ApplyAffineAnimFrame(u8 matrixNum, struct AffineAnimFrameCmd *frameCmd);
 static u8 IndexOfSpriteTileTag(u16 tag);
+static void AddSpriteTileTagToHash(u8 index);
+static void RemoveSpriteTileTagFromHash(u8 index);
 static void AllocSpriteTileRange(u16 tag, u16 start, u16 count);
 static void DoLoadSpritePalette(const u16 *src, u16 paletteOffset);
 static void obj_update_pos2(struct Sprite* sprite, s32 a1, s32 a2);
@@ -294,6 +295,7 @@ static const struct OamDimensions sOamDimensions[3][4] =
 // iwram bss
 static u16 sSpriteTileRangeTags[MAX_SPRITES];
 static u16 sSpriteTileRanges[MAX_SPRITES * 2];
+static u8 sSpriteTileTagHash[TILE_TAG_HASH_SIZE]; // range index + 1, 0 when empty
 static struct AffineAnimState sAffineAnimStates[OAM_MATRIX_COUNT];
 static u16 sSpritePaletteTags[16];
 
@@ -302,7 +304,10 @@ u32 gOamMatrixAllocBitmap;
 u8 gReservedSpritePaletteCount;
 
 EWRAM_DATA struct Sprite gSprites[MAX_SPRITES + 1] = {0};
-EWRAM_DATA static u16 sSpritePriorities[MAX_SPRITES] = {0};
+EWRAM_DATA static u32 sSpriteSortKeys[MAX_SPRITES] = {0};
+EWRAM_DATA static bool8 sSpriteSortKeyDirty[MAX_SPRITES] = {0};
+EWRAM_DATA static u8 sSpriteSortDirtyCount = 0;
+EWRAM_DATA static bool8 sSpriteSortKeysValid = FALSE;
 EWRAM_DATA static u8 sSpriteOrder[MAX_SPRITES] = {0};
 EWRAM_DATA static bool8 sShouldProcessSpriteCopyRequests = 0;
 EWRAM_DATA static u8 sSpriteCopyRequestCount = 0;
@@ -315,8 +320,6 @@ EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
 EWRAM_DATA bool8 gAffineAnimsDisabled = FALSE;
 
-static u32 OamSortOrdernCount;
-
 
 struct FastSpriteQueue {
     struct FastSpriteQueue* next;
@@ -403,7 +406,6 @@ u8 CreateSpriteFast(const struct SpriteTemplate *template, s16 x, s16 y, u8 subp
 
 void ResetSpriteData(void)
 {
-    OamSortOrdernCount = 0;
     ResetOamRange(0, 128);
     ResetAllSprites();
     ClearSpriteCopyRequests();
@@ -420,6 +422,8 @@ void ResetSpriteData(void)
 void AnimateSprites(void)
 {
     u8 i;
+    TRACE_BEGIN(TRACE_ANIMATE_SPRITES);
+    FRAME_BUDGET_BEGIN(FRAME_BUDGET_SPRITES);
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
@@ -432,11 +436,15 @@ void AnimateSprites(void)
                 AnimateSprite(sprite);
         }
     }
+    FRAME_BUDGET_END(FRAME_BUDGET_SPRITES);
+    TRACE_END(TRACE_ANIMATE_SPRITES);
 }
 
 void BuildOamBuffer(void)
 {
     u8 temp;
+    TRACE_BEGIN(TRACE_BUILD_OAM_BUFFER);
+    FRAME_BUDGET_BEGIN(FRAME_BUDGET_OAM);
     UpdateOamCoords();
     BuildSpritePriorities();
     SortSprites();
@@ -446,23 +454,8 @@ void BuildOamBuffer(void)
     CopyMatricesToOamBuffer();
     gMain.oamLoadDisabled = temp;
     sShouldProcessSpriteCopyRequests = TRUE;
-}
-
-void BuildOamBufferNoOrder(void)
-{
-    
-    u8 temp;
-    UpdateOamCoords();
-    if ((OamSortOrdernCount++ & 0x7FFFFFFF) % 4 == 0) {
-        BuildSpritePriorities();
-        SortSprites();
-    }
-    temp = gMain.oamLoadDisabled;
-    gMain.oamLoadDisabled = TRUE;
-    AddSpritesToOamBuffer();
-    CopyMatricesToOamBuffer();
-    gMain.oamLoadDisabled = temp;
-    sShouldProcessSpriteCopyRequests = TRUE;
+    FRAME_BUDGET_END(FRAME_BUDGET_OAM);
+    TRACE_END(TRACE_BUILD_OAM_BUFFER);
 }
 
 void UpdateOamCoords(void)
@@ -487,107 +480,104 @@ void UpdateOamCoords(void)
     }
 }
 
+// Sprites are drawn in ascending (priority, subpriority) order and, within
+// that, from the bottom of the screen up. Everything SortSprites compares is
+// packed into one key per sprite so that only sprites whose key changed since
+// the previous frame have to be moved in sSpriteOrder.
+#define SPRITE_SORT_KEY(priority, y) (((u32)(priority) << 9) | (u16)(0x100 - (y)))
+
+static s16 GetSpriteSortY(struct Sprite *sprite)
+{
+    s16 y = sprite->oam.y;
+
+    if (y >= DISPLAY_HEIGHT)
+        y = y - 256;
+
+    if (sprite->oam.affineMode == ST_OAM_AFFINE_DOUBLE
+     && sprite->oam.size == ST_OAM_SIZE_3)
+    {
+        u32 shape = sprite->oam.shape;
+        if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
+        {
+            if (y > 128)
+                y = y - 256;
+        }
+    }
+
+    return y;
+}
+
 void BuildSpritePriorities(void)
 {
     u16 i;
+
+    sSpriteSortDirtyCount = 0;
     for (i = 0; i < MAX_SPRITES; i++)
     {
         struct Sprite *sprite = &gSprites[i];
         u16 priority = sprite->subpriority | (sprite->oam.priority << 8);
-        sSpritePriorities[i] = priority;
+        u32 key = SPRITE_SORT_KEY(priority, GetSpriteSortY(sprite));
+
+        if (key != sSpriteSortKeys[i] || !sSpriteSortKeysValid)
+        {
+            sSpriteSortKeys[i] = key;
+            sSpriteSortKeyDirty[i] = TRUE;
+            sSpriteSortDirtyCount++;
+        }
     }
+    sSpriteSortKeysValid = TRUE;
 }
 
+// Equivalent to a stable insertion sort of last frame's order by the current
+// keys. Entries whose key is unchanged are still in order relative to each
+// other, so only the dirty ones are pulled out, sorted and merged back in.
+// Ties are broken by previous position, exactly like the insertion sort.
 void SortSprites(void)
 {
-    u8 i;
-    for (i = 1; i < MAX_SPRITES; i++)
-    {
-        u8 j = i;
-        struct Sprite *sprite1 = &gSprites[sSpriteOrder[i - 1]];
-        struct Sprite *sprite2 = &gSprites[sSpriteOrder[i]];
-        u16 sprite1Priority = sSpritePriorities[sSpriteOrder[i - 1]];
-        u16 sprite2Priority = sSpritePriorities[sSpriteOrder[i]];
-        s16 sprite1Y = sprite1->oam.y;
-        s16 sprite2Y = sprite2->oam.y;
+    u32 cleanKeys[MAX_SPRITES];
+    u32 dirtyKeys[MAX_SPRITES];
+    u8 dirtyIds[MAX_SPRITES];
+    u8 cleanCount = 0;
+    u8 dirtyCount = 0;
+    u8 i, j, k;
 
-        if (sprite1Y >= DISPLAY_HEIGHT)
-            sprite1Y = sprite1Y - 256;
+    if (sSpriteSortDirtyCount == 0)
+        return;
 
-        if (sprite2Y >= DISPLAY_HEIGHT)
-            sprite2Y = sprite2Y - 256;
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        u8 id = sSpriteOrder[i];
+        u32 key = (sSpriteSortKeys[id] << 6) | i;
 
-        if (sprite1->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-         && sprite1->oam.size == ST_OAM_SIZE_3)
+        if (sSpriteSortKeyDirty[id])
         {
-            u32 shape = sprite1->oam.shape;
-            if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
+            sSpriteSortKeyDirty[id] = FALSE;
+            for (j = dirtyCount; j > 0 && dirtyKeys[j - 1] > key; j--)
             {
-                if (sprite1Y > 128)
-                    sprite1Y = sprite1Y - 256;
+                dirtyKeys[j] = dirtyKeys[j - 1];
+                dirtyIds[j] = dirtyIds[j - 1];
             }
+            dirtyKeys[j] = key;
+            dirtyIds[j] = id;
+            dirtyCount++;
         }
-
-        if (sprite2->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-         && sprite2->oam.size == ST_OAM_SIZE_3)
+        else
         {
-            u32 shape = sprite2->oam.shape;
-            if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-            {
-                if (sprite2Y > 128)
-                    sprite2Y = sprite2Y - 256;
-            }
+            sSpriteOrder[cleanCount] = id;
+            cleanKeys[cleanCount] = key;
+            cleanCount++;
         }
+    }
 
-        while (j > 0
-            && ((sprite1Priority > sprite2Priority)
-             || (sprite1Priority == sprite2Priority && sprite1Y < sprite2Y)))
-        {
-            u8 temp = sSpriteOrder[j];
-            sSpriteOrder[j] = sSpriteOrder[j - 1];
-            sSpriteOrder[j - 1] = temp;
-
-            // UB: If j equals 1, then j-- makes j equal 0.
-            // Then, sSpriteOrder[-1] gets accessed below.
-            // Although this doesn't result in a bug in the ROM,
-            // the behavior is undefined.
-            j--;
-
-            sprite1 = &gSprites[sSpriteOrder[j - 1]];
-            sprite2 = &gSprites[sSpriteOrder[j]];
-            sprite1Priority = sSpritePriorities[sSpriteOrder[j - 1]];
-            sprite2Priority = sSpritePriorities[sSpriteOrder[j]];
-            sprite1Y = sprite1->oam.y;
-            sprite2Y = sprite2->oam.y;
-
-            if (sprite1Y >= DISPLAY_HEIGHT)
-                sprite1Y = sprite1Y - 256;
-
-            if (sprite2Y >= DISPLAY_HEIGHT)
-                sprite2Y = sprite2Y - 256;
-
-            if (sprite1->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-             && sprite1->oam.size == ST_OAM_SIZE_3)
-            {
-                u32 shape = sprite1->oam.shape;
-                if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-                {
-                    if (sprite1Y > 128)
-                        sprite1Y = sprite1Y - 256;
-                }
-            }
-
-            if (sprite2->oam.affineMode == ST_OAM_AFFINE_DOUBLE
-             && sprite2->oam.size == ST_OAM_SIZE_3)
-            {
-                u32 shape = sprite2->oam.shape;
-                if (shape == ST_OAM_SQUARE || shape == ST_OAM_V_RECTANGLE)
-                {
-                    if (sprite2Y > 128)
-                        sprite2Y = sprite2Y - 256;
-                }
-            }
-        }
+    i = cleanCount;
+    j = dirtyCount;
+    k = MAX_SPRITES;
+    while (j > 0)
+    {
+        if (i > 0 && cleanKeys[i - 1] > dirtyKeys[j - 1])
+            sSpriteOrder[--k] = sSpriteOrder[--i];
+        else
+            sSpriteOrder[--k] = dirtyIds[--j];
     }
 }
 
@@ -774,12 +764,7 @@ void DestroySprite(struct Sprite *sprite)
     if (sprite->inUse)
     {
         if (!sprite->usingSheet)
-        {
-            u16 i;
-            u16 tileEnd = (sprite->images->size / TILE_SIZE_4BPP) + sprite->oam.tileNum;
-            for (i = sprite->oam.tileNum; i < tileEnd; i++)
-                FREE_SPRITE_TILE(i);
-        }
+            BitsetClearRange(sSpriteTileAllocBitmap, sprite->oam.tileNum, sprite->images->size / TILE_SIZE_4BPP);
         ResetSprite(sprite);
     }
 }
@@ -857,57 +842,53 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
+// Takes the smallest free run that fits, so big runs are left for big
+// sheets instead of being nibbled at by small ones.
 s16 AllocSpriteTiles(u16 tileCount)
 {
-    u16 i;
     s16 start;
-    u16 numTilesFound;
 
     if (tileCount == 0)
     {
         // Free all unreserved tiles if the tile count is 0.
-        for (i = gReservedSpriteTileCount; i < TOTAL_OBJ_TILE_COUNT; i++)
-            FREE_SPRITE_TILE(i);
-
+        BitsetClearRange(sSpriteTileAllocBitmap, gReservedSpriteTileCount, TOTAL_OBJ_TILE_COUNT - gReservedSpriteTileCount);
         return 0;
     }
 
-    i = gReservedSpriteTileCount;
-
-    for (;;)
-    {
-        while (SPRITE_TILE_IS_ALLOCATED(i))
-        {
-            i++;
+    start = FindFreeSpriteTiles(gReservedSpriteTileCount, tileCount, TRUE);
+    if (start >= 0)
+        BitsetSetRange(sSpriteTileAllocBitmap, start, tileCount);
+    return start;
+}
 
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
-        }
+// Walks the free runs from FIRST on, returning either the first one that
+// fits or the smallest, the earliest among equals. -1 if none fits.
+static s16 FindFreeSpriteTiles(u16 first, u16 tileCount, bool8 bestFit)
+{
+    s32 start, end;
+    s16 best = -1;
+    u16 bestCount = 0xFFFF;
 
-        start = i;
-        numTilesFound = 1;
+    while (first < TOTAL_OBJ_TILE_COUNT)
+    {
+        start = BitsetFindFirstClear(sSpriteTileAllocBitmap, first, TOTAL_OBJ_TILE_COUNT - first);
+        if (start < 0)
+            break;
+        end = BitsetFindFirstSet(sSpriteTileAllocBitmap, start, TOTAL_OBJ_TILE_COUNT - start);
+        if (end < 0)
+            end = TOTAL_OBJ_TILE_COUNT;
 
-        while (numTilesFound != tileCount)
+        if (end - start >= tileCount && end - start < bestCount)
         {
-            i++;
-
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
-
-            if (!SPRITE_TILE_IS_ALLOCATED(i))
-                numTilesFound++;
-            else
+            best = start;
+            bestCount = end - start;
+            if (!bestFit || bestCount == tileCount)
                 break;
         }
-
-        if (numTilesFound == tileCount)
-            break;
+        first = end;
     }
 
-    for (i = start; i < tileCount + start; i++)
-        ALLOC_SPRITE_TILE(i);
-
-    return start;
+    return best;
 }
 
 u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
@@ -1012,6 +993,7 @@ void ResetAllSprites(void)
         ResetSprite(&gSprites[i]);
         sSpriteOrder[i] = i;
     }
+    sSpriteSortKeysValid = FALSE;
 
     ResetSprite(&gSprites[i]);
 }
@@ -1656,12 +1638,30 @@ void LoadSpriteSheets(const struct SpriteSheet *sheets)
         LoadSpriteSheet(&sheets[i]);
 }
 
+// Like LoadSpriteSheet, but leaves the tiles for the caller to fill in.
+// Returns -1 if there was no room, since tile 0 is a valid start.
+s16 AllocTilesForSpriteSheet(struct SpriteSheet *sheet)
+{
+    s16 tileStart = AllocSpriteTiles(sheet->size / TILE_SIZE_4BPP);
+
+    if (tileStart < 0)
+        return -1;
+
+    AllocSpriteTileRange(sheet->tag, (u16)tileStart, sheet->size / TILE_SIZE_4BPP);
+    return tileStart;
+}
+
+void AllocTilesForSpriteSheets(struct SpriteSheet *sheets)
+{
+    u8 i;
+    for (i = 0; sheets[i].data != NULL; i++)
+        AllocTilesForSpriteSheet(&sheets[i]);
+}
+
 
 void FreeSummaryMonSprite(u16 start)
 {
-    u32 i;
-    for (i = start; i < start + 16; i++)
-        FREE_SPRITE_TILE(i);
+    BitsetClearRange(sSpriteTileAllocBitmap, start, 16);
 }
 
 
@@ -1670,19 +1670,8 @@ void FreeSpriteTilesByTag(u16 tag)
     u8 index = IndexOfSpriteTileTag(tag);
     if (index != 0xFF)
     {
-        u16 i;
-        u16 *rangeStarts;
-        u16 *rangeCounts;
-        u16 start;
-        u16 count;
-        rangeStarts = sSpriteTileRanges;
-        start = rangeStarts[index * 2];
-        rangeCounts = sSpriteTileRanges + 1;
-        count = rangeCounts[index * 2];
-
-        for (i = start; i < start + count; i++)
-            FREE_SPRITE_TILE(i);
-
+        BitsetClearRange(sSpriteTileAllocBitmap, sSpriteTileRanges[index * 2], sSpriteTileRanges[index * 2 + 1]);
+        RemoveSpriteTileTagFromHash(index);
         sSpriteTileRangeTags[index] = 0xFFFF;
     }
 }
@@ -1696,6 +1685,7 @@ void FreeSpriteTileRanges(void)
         sSpriteTileRangeTags[i] = 0xFFFF;
         SET_SPRITE_TILE_RANGE(i, 0, 0);
     }
+    memset(sSpriteTileTagHash, 0, sizeof(sSpriteTileTagHash));
 }
 
 u16 GetSpriteTileStartByTag(u16 tag)
@@ -1706,17 +1696,62 @@ u16 GetSpriteTileStartByTag(u16 tag)
     return sSpriteTileRanges[index * 2];
 }
 
+static u32 HashSpriteTileTag(u16 tag)
+{
+    return (u16)(tag * 40503) >> (16 - TILE_TAG_HASH_BITS);
+}
+
+// Ranges of the same tag are found in the order they were added.
 u8 IndexOfSpriteTileTag(u16 tag)
 {
-    u8 i;
+    u32 slot = HashSpriteTileTag(tag);
 
-    for (i = 0; i < MAX_SPRITES; i++)
-        if (sSpriteTileRangeTags[i] == tag)
-            return i;
+    while (sSpriteTileTagHash[slot] != 0)
+    {
+        if (sSpriteTileRangeTags[sSpriteTileTagHash[slot] - 1] == tag)
+            return sSpriteTileTagHash[slot] - 1;
+        slot = (slot + 1) & (TILE_TAG_HASH_SIZE - 1);
+    }
 
     return 0xFF;
 }
 
+static void AddSpriteTileTagToHash(u8 index)
+{
+    u32 slot = HashSpriteTileTag(sSpriteTileRangeTags[index]);
+
+    while (sSpriteTileTagHash[slot] != 0)
+        slot = (slot + 1) & (TILE_TAG_HASH_SIZE - 1);
+    sSpriteTileTagHash[slot] = index + 1;
+}
+
+// Later entries of the probe run are moved back into the gap when their home
+// slot allows it, so lookups never stop short at an emptied slot.
+static void RemoveSpriteTileTagFromHash(u8 index)
+{
+    u32 slot = HashSpriteTileTag(sSpriteTileRangeTags[index]);
+    u32 next, home;
+
+    while (sSpriteTileTagHash[slot] != index + 1)
+        slot = (slot + 1) & (TILE_TAG_HASH_SIZE - 1);
+
+    next = slot;
+    for (;;)
+    {
+        next = (next + 1) & (TILE_TAG_HASH_SIZE - 1);
+        if (sSpriteTileTagHash[next] == 0)
+            break;
+
+        home = HashSpriteTileTag(sSpriteTileRangeTags[sSpriteTileTagHash[next] - 1]);
+        if (((next - home) & (TILE_TAG_HASH_SIZE - 1)) >= ((next - slot) & (TILE_TAG_HASH_SIZE - 1)))
+        {
+            sSpriteTileTagHash[slot] = sSpriteTileTagHash[next];
+            slot = next;
+        }
+    }
+    sSpriteTileTagHash[slot] = 0;
+}
+
 u16 GetSpriteTileTagByTileStart(u16 start)
 {
     u8 i;
@@ -1732,9 +1767,188 @@ u16 GetSpriteTileTagByTileStart(u16 start)
 
 void AllocSpriteTileRange(u16 tag, u16 start, u16 count)
 {
-    u8 freeIndex = IndexOfSpriteTileTag(0xFFFF);
-    sSpriteTileRangeTags[freeIndex] = tag;
-    SET_SPRITE_TILE_RANGE(freeIndex, start, count);
+    u8 i;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        if (sSpriteTileRangeTags[i] == 0xFFFF)
+        {
+            sSpriteTileRangeTags[i] = tag;
+            SET_SPRITE_TILE_RANGE(i, start, count);
+            if (tag != 0xFFFF)
+                AddSpriteTileTagToHash(i);
+            return;
+        }
+    }
+}
+
+static char GetSpriteTileBlockLetter(u8 n)
+{
+    if (n < 26)
+        return 'A' + n;
+    if (n < 52)
+        return 'a' + n - 26;
+    return '?';
+}
+
+struct SpriteTileBlock
+{
+    u16 start;
+    u16 count;
+    u8 owner; // range index, or MAX_SPRITES + sprite id for sprites without a sheet
+};
+
+static u8 GetSpriteTileBlocks(struct SpriteTileBlock *blocks)
+{
+    struct SpriteTileBlock block;
+    u8 count = 0;
+    u8 i, j;
+
+    for (i = 0; i < MAX_SPRITES * 2; i++)
+    {
+        if (i < MAX_SPRITES)
+        {
+            if (sSpriteTileRangeTags[i] == 0xFFFF || sSpriteTileRanges[i * 2 + 1] == 0)
+                continue;
+            block.start = sSpriteTileRanges[i * 2];
+            block.count = sSpriteTileRanges[i * 2 + 1];
+        }
+        else
+        {
+            struct Sprite *sprite = &gSprites[i - MAX_SPRITES];
+
+            if (!sprite->inUse || sprite->usingSheet || sprite->images->size < TILE_SIZE_4BPP)
+                continue;
+            block.start = sprite->oam.tileNum;
+            block.count = sprite->images->size / TILE_SIZE_4BPP;
+        }
+        block.owner = i;
+
+        for (j = count; j > 0 && blocks[j - 1].start > block.start; j--)
+            blocks[j] = blocks[j - 1];
+        blocks[j] = block;
+        count++;
+    }
+
+    return count;
+}
+
+static void MoveSpriteTileBlock(const struct SpriteTileBlock *block, u16 newStart)
+{
+    u8 i;
+
+    CpuCopy32((u8 *)OBJ_VRAM0 + TILE_SIZE_4BPP * block->start,
+              (u8 *)OBJ_VRAM0 + TILE_SIZE_4BPP * newStart,
+              TILE_SIZE_4BPP * block->count);
+
+    if (block->owner < MAX_SPRITES)
+        sSpriteTileRanges[block->owner * 2] = newStart;
+
+    for (i = 0; i < MAX_SPRITES; i++)
+    {
+        struct Sprite *sprite = &gSprites[i];
+
+        if (!sprite->inUse)
+            continue;
+        if (sprite->oam.tileNum >= block->start && sprite->oam.tileNum < block->start + block->count)
+            sprite->oam.tileNum = sprite->oam.tileNum - block->start + newStart;
+        if (sprite->usingSheet && sprite->sheetTileStart == block->start)
+            sprite->sheetTileStart = newStart;
+    }
+}
+
+// Slides every sheet and sheetless sprite down into the free tiles below it,
+// so the free tiles end up in one run at the top, and points the live sprites
+// at the new tiles. Allocations with no known owner, and owners whose tiles
+// overlap, are left in place. Tile numbers kept anywhere but gSprites go
+// stale and have to be looked up again by tag. The copy shows if it happens
+// mid-frame, so it's best done while the screen is faded out. Returns FALSE
+// if sprite copies are still queued, as their destinations would be wrong.
+bool8 CompactSpriteTiles(void)
+{
+    struct SpriteTileBlock blocks[MAX_SPRITES * 2];
+    u8 count, i;
+    s16 newStart;
+
+    if (sSpriteCopyRequestCount != 0)
+        return FALSE;
+
+    count = GetSpriteTileBlocks(blocks);
+    for (i = 0; i < count; i++)
+    {
+        if (blocks[i].start < gReservedSpriteTileCount
+         || blocks[i].start + blocks[i].count > TOTAL_OBJ_TILE_COUNT
+         || BitsetCount(sSpriteTileAllocBitmap, blocks[i].start, blocks[i].count) != blocks[i].count
+         || (i > 0 && blocks[i - 1].start + blocks[i - 1].count > blocks[i].start)
+         || (i + 1 < count && blocks[i].start + blocks[i].count > blocks[i + 1].start))
+            continue;
+
+        // Freed first, so the block can always land where it already is.
+        BitsetClearRange(sSpriteTileAllocBitmap, blocks[i].start, blocks[i].count);
+        newStart = FindFreeSpriteTiles(gReservedSpriteTileCount, blocks[i].count, FALSE);
+        BitsetSetRange(sSpriteTileAllocBitmap, newStart, blocks[i].count);
+        if (newStart != blocks[i].start)
+        {
+            MoveSpriteTileBlock(&blocks[i], newStart);
+            blocks[i].start = newStart;
+        }
+    }
+
+    return TRUE;
+}
+
+// Writes the tile map to mGBA's debug log, 64 tiles per line: '.' for free,
+// '=' for reserved, a letter per sheet (A-Z, then a-z) or '*' for a sheetless
+// sprite, and '#' for tiles nothing owns. The sheets are listed after it.
+void DumpSpriteTileMap(void)
+{
+    struct SpriteTileBlock blocks[MAX_SPRITES * 2];
+    char line[65];
+    u8 count, i, letter;
+    u16 tile, j;
+
+    if (!mgba_open())
+        return;
+
+    count = GetSpriteTileBlocks(blocks);
+    mgba_printf(LOGINFO, "SPRITE TILES %u free", TOTAL_OBJ_TILE_COUNT
+                - BitsetCount(sSpriteTileAllocBitmap, 0, TOTAL_OBJ_TILE_COUNT));
+
+    for (tile = 0; tile < TOTAL_OBJ_TILE_COUNT; tile += 64)
+    {
+        for (j = 0; j < 64; j++)
+        {
+            if (!SPRITE_TILE_IS_ALLOCATED(tile + j))
+                line[j] = '.';
+            else if (tile + j < gReservedSpriteTileCount)
+                line[j] = '=';
+            else
+                line[j] = '#';
+        }
+        line[64] = '\0';
+
+        for (i = 0, letter = 0; i < count; i++)
+        {
+            for (j = blocks[i].start; j < blocks[i].start + blocks[i].count; j++)
+            {
+                if (j >= tile && j < tile + 64 && line[j - tile] != '.')
+                    line[j - tile] = blocks[i].owner >= MAX_SPRITES ? '*' : GetSpriteTileBlockLetter(letter);
+            }
+            if (blocks[i].owner < MAX_SPRITES)
+                letter++;
+        }
+        mgba_printf(LOGINFO, "%03X %s", tile, line);
+    }
+
+    for (i = 0, letter = 0; i < count; i++)
+    {
+        if (blocks[i].owner >= MAX_SPRITES)
+            continue;
+        mgba_printf(LOGINFO, "%c tag %04X tiles %03X-%03X", GetSpriteTileBlockLetter(letter),
+                    sSpriteTileRangeTags[blocks[i].owner], blocks[i].start, blocks[i].start + blocks[i].count - 1);
+        letter++;
+    }
+    mgba_close();
 }
 
 void FreeAllSpritePalettes(void)
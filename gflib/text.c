@@ -8,12 +8,35 @@
 #include "string_util.h"
 #include "window.h"
 #include "text.h"
+#include "malloc.h"
 #include "blit.h"
 #include "menu.h"
 #include "dynamic_placeholder_text_util.h"
 
+#define GLYPH_CACHE_SETS 16
+#define GLYPH_CACHE_WAYS 2
+
+// Glyphs exactly as DecompressGlyphFont* leaves them in gUnknown_03002F90,
+// i.e. already expanded to the printer's colors.
+struct GlyphCacheEntry
+{
+    u16 glyphId;
+    u16 colors;
+    u8 fontGlyphId; // 0xFF if the entry is unused
+    u8 japanese;
+    struct Struct_03002F90 glyph;
+};
+
+// Two-way set associative, so a lookup only compares two keys.
+struct GlyphCache
+{
+    struct GlyphCacheEntry entries[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS];
+    u8 leastRecentWay[GLYPH_CACHE_SETS];
+};
+
 EWRAM_DATA struct TextPrinter gTempTextPrinter = {0};
 EWRAM_DATA struct TextPrinter gTextPrinters[NUM_TEXT_PRINTERS] = {0};
+EWRAM_DATA static struct GlyphCache *sGlyphCache = NULL;
 
 static u16 gFontHalfRowLookupTable[0x51];
 static u16 gLastTextBgColor;
@@ -228,7 +251,7 @@ bool16 AddTextPrinter(struct TextPrinterTemplate *printerTemplate, u8 speed, voi
         }
 
         if (speed != TEXT_SPEED_FF)
-            CopyWindowToVram(gTempTextPrinter.printerTemplate.windowId, 2);
+            CopyWindowDirtyTilesToVram(gTempTextPrinter.printerTemplate.windowId);
         gTextPrinters[printerTemplate->windowId].active = 0;
     }
     gUnknown_03002F84 = 0;
@@ -253,12 +276,12 @@ void RunTextPrinters(void)
                         switch (temp)
                         {
                         case 3:
-                            CopyWindowToVram(gTextPrinters[i].printerTemplate.windowId, 2);
+                            CopyWindowDirtyTilesToVram(gTextPrinters[i].printerTemplate.windowId);
                             if (gTextPrinters[i].callback != 0)
                                 gTextPrinters[i].callback(&gTextPrinters[i].printerTemplate, temp);
                             break;
                         case 1:
-                            CopyWindowToVram(gTextPrinters[i].printerTemplate.windowId, 2);
+                            CopyWindowDirtyTilesToVram(gTextPrinters[i].printerTemplate.windowId);
                             gTextPrinters[i].active = 0;
                             break;
                         }
@@ -270,7 +293,7 @@ void RunTextPrinters(void)
                     switch (temp)
                     {
                     case 0:
-                        CopyWindowToVram(gTextPrinters[i].printerTemplate.windowId, 2);
+                        CopyWindowDirtyTilesToVram(gTextPrinters[i].printerTemplate.windowId);
                     case 3:
                         if (gTextPrinters[i].callback != 0)
                             gTextPrinters[i].callback(&gTextPrinters[i].printerTemplate, temp);
@@ -464,6 +487,77 @@ void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor)
     GenerateFontHalfRowLookupTable(*fgColor, *bgColor, *shadowColor);
 }
 
+// Allocates the glyph cache, if GLYPH_CACHE_ENABLED. Call right after
+// InitHeap so the block sits at the bottom of the heap instead of splitting it.
+void InitGlyphCache(void)
+{
+    s32 i, j;
+
+    if (!GLYPH_CACHE_ENABLED)
+        return;
+
+    sGlyphCache = Alloc(sizeof(struct GlyphCache));
+    if (sGlyphCache == NULL)
+        return;
+
+    for (i = 0; i < GLYPH_CACHE_SETS; i++)
+    {
+        for (j = 0; j < GLYPH_CACHE_WAYS; j++)
+            sGlyphCache->entries[i][j].fontGlyphId = 0xFF;
+        sGlyphCache->leastRecentWay[i] = 0;
+    }
+}
+
+// Only glyph sets that RenderText actually decompresses are cached.
+#define IS_CACHED_FONT_GLYPH_ID(fontGlyphId) ((fontGlyphId) <= 8 && (fontGlyphId) != 6)
+#define GLYPH_CACHE_SET(fontGlyphId, glyphId) ((((glyphId) >> 4) ^ (glyphId) ^ (fontGlyphId)) % GLYPH_CACHE_SETS)
+#define GLYPH_CACHE_COLORS ((gLastTextFgColor << 8) | (gLastTextBgColor << 4) | gLastTextShadowColor)
+
+static bool8 LoadCachedGlyph(u8 fontGlyphId, u16 glyphId, bool32 japanese)
+{
+    struct GlyphCacheEntry *entries;
+    u16 colors = GLYPH_CACHE_COLORS;
+    u8 set, way;
+
+    if (!GLYPH_CACHE_ENABLED || sGlyphCache == NULL || !IS_CACHED_FONT_GLYPH_ID(fontGlyphId))
+        return FALSE;
+
+    set = GLYPH_CACHE_SET(fontGlyphId, glyphId);
+    entries = sGlyphCache->entries[set];
+    for (way = 0; way < GLYPH_CACHE_WAYS; way++)
+    {
+        if (entries[way].fontGlyphId == fontGlyphId
+         && entries[way].glyphId == glyphId
+         && entries[way].colors == colors
+         && entries[way].japanese == japanese)
+        {
+            gUnknown_03002F90 = entries[way].glyph;
+            sGlyphCache->leastRecentWay[set] = way ^ 1;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+static void CacheGlyph(u8 fontGlyphId, u16 glyphId, bool32 japanese)
+{
+    struct GlyphCacheEntry *entry;
+    u8 set, way;
+
+    if (!GLYPH_CACHE_ENABLED || sGlyphCache == NULL || !IS_CACHED_FONT_GLYPH_ID(fontGlyphId))
+        return;
+
+    set = GLYPH_CACHE_SET(fontGlyphId, glyphId);
+    way = sGlyphCache->leastRecentWay[set];
+    entry = &sGlyphCache->entries[set][way];
+    entry->fontGlyphId = fontGlyphId;
+    entry->glyphId = glyphId;
+    entry->colors = GLYPH_CACHE_COLORS;
+    entry->japanese = japanese;
+    entry->glyph = gUnknown_03002F90;
+    sGlyphCache->leastRecentWay[set] = way ^ 1;
+}
+
 void DecompressGlyphTile(const void *src_, void *dest_)
 {
     u32 temp;
@@ -585,6 +679,9 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
             GLYPH_COPY(windowTiles, widthOffset, currX + 8, currY + 8, unkStruct + 24, r4 - 8, r0 - 8);
         }
     }
+
+    if (r4 > 0 && r0 > 0)
+        MarkWindowRectDirty(textPrinter->printerTemplate.windowId, currX, currY, r4, r0);
 }
 
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
@@ -611,6 +708,12 @@ void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
             width,
             *glyphHeight,
             gLastTextBgColor);
+        MarkWindowRectDirty(
+            textPrinter->printerTemplate.windowId,
+            textPrinter->printerTemplate.currentX,
+            textPrinter->printerTemplate.currentY,
+            width,
+            *glyphHeight);
     }
 }
 
@@ -768,7 +871,7 @@ void TextPrinterDrawDownArrow(struct TextPrinter *textPrinter)
                 textPrinter->printerTemplate.currentY,
                 8,
                 16);
-            CopyWindowToVram(textPrinter->printerTemplate.windowId, 2);
+            CopyWindowDirtyTilesToVram(textPrinter->printerTemplate.windowId);
 
             subStruct->downArrowDelay = 8;
             subStruct->downArrowYPosIdx++;
@@ -785,7 +888,7 @@ void TextPrinterClearDownArrow(struct TextPrinter *textPrinter)
         textPrinter->printerTemplate.currentY,
         8,
         16);
-    CopyWindowToVram(textPrinter->printerTemplate.windowId, 2);
+    CopyWindowDirtyTilesToVram(textPrinter->printerTemplate.windowId);
 }
 
 bool8 TextPrinterWaitAutoMode(struct TextPrinter *textPrinter)
@@ -877,7 +980,7 @@ void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool8 drawArrow, u8 *c
                 y - 2,
                 0x8,
                 0x10);
-            CopyWindowToVram(windowId, 0x2);
+            CopyWindowDirtyTilesToVram(windowId);
             *counter = 8;
             ++*yCoordIndex;
         }
@@ -1076,28 +1179,32 @@ u16 RenderText(struct TextPrinter *textPrinter)
             return 1;
         }
 
-        switch (subStruct->glyphId)
+        if (!LoadCachedGlyph(subStruct->glyphId, currChar, textPrinter->japanese))
         {
-        case 0:
-            DecompressGlyphFont0(currChar, textPrinter->japanese);
-            break;
-        case 1:
-            DecompressGlyphFont1(currChar, textPrinter->japanese);
-            break;
-        case 2:
-        case 3:
-        case 4:
-        case 5:
-            DecompressGlyphFont2(currChar, textPrinter->japanese);
-            break;
-        case 7:
-            DecompressGlyphFont7(currChar, textPrinter->japanese);
-            break;
-        case 8:
-            DecompressGlyphFont8(currChar, textPrinter->japanese);
-            break;
-        case 6:
-            break;
+            switch (subStruct->glyphId)
+            {
+            case 0:
+                DecompressGlyphFont0(currChar, textPrinter->japanese);
+                break;
+            case 1:
+                DecompressGlyphFont1(currChar, textPrinter->japanese);
+                break;
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+                DecompressGlyphFont2(currChar, textPrinter->japanese);
+                break;
+            case 7:
+                DecompressGlyphFont7(currChar, textPrinter->japanese);
+                break;
+            case 8:
+                DecompressGlyphFont8(currChar, textPrinter->japanese);
+                break;
+            case 6:
+                break;
+            }
+            CacheGlyph(subStruct->glyphId, currChar, textPrinter->japanese);
         }
 
         CopyGlyphToWindow(textPrinter);
@@ -1157,7 +1264,7 @@ u16 RenderText(struct TextPrinter *textPrinter)
                 ScrollWindow(textPrinter->printerTemplate.windowId, 0, speed, PIXEL_FILL(textPrinter->printerTemplate.bgColor));
                 textPrinter->scrollDistance -= speed;
             }
-            CopyWindowToVram(textPrinter->printerTemplate.windowId, 2);
+            CopyWindowDirtyTilesToVram(textPrinter->printerTemplate.windowId);
         }
         else
         {
@@ -14,12 +14,26 @@ extern u32 gUnneededFireRedVariable;
 
 #define WINDOWS_MAX  32
 
+// The span of tiles in each window's buffer that changed since the window
+// was last uploaded. Drawing functions record the rect they touched so that
+// text printers only upload those tiles. Other writes mark the whole window,
+// and a window whose buffer has been handed out is always uploaded in full.
+struct WindowDirtyTiles
+{
+    u16 start;
+    u16 end;
+    bool8 untracked;
+};
+
 EWRAM_DATA struct Window gWindows[WINDOWS_MAX] = {0};
+EWRAM_DATA static struct WindowDirtyTiles sWindowDirtyTiles[WINDOWS_MAX] = {0};
 EWRAM_DATA static struct Window* sWindowPtr = NULL;
 EWRAM_DATA static u16 sWindowSize = 0;
 
 static u8 GetNumActiveWindowsOnBg(u8 bgId);
 static u8 GetNumActiveWindowsOnBg8Bit(u8 bgId);
+static void ResetWindowDirtyTiles(u8 windowId);
+static void MarkWindowDirty(u8 windowId);
 
 static const struct WindowTemplate sDummyWindowTemplate = DUMMY_WIN_TEMPLATE;
 
@@ -53,6 +67,9 @@ bool16 InitWindows(const struct WindowTemplate *templates)
         gWindows[i].tileData = NULL;
     }
 
+    for (i = 0; i < WINDOWS_MAX; ++i)
+        ResetWindowDirtyTiles(i);
+
     for (i = 0, allocatedBaseBlock = 0, bgLayer = templates[i].bg; bgLayer != 0xFF && i < 0x20; ++i, bgLayer = templates[i].bg)
     {
         if (gUnneededFireRedVariable == 1)
@@ -173,6 +190,7 @@ u16 AddWindow(const struct WindowTemplate *template)
 
     gWindows[win].tileData = allocatedTilemapBuffer;
     gWindows[win].window = *template;
+    ResetWindowDirtyTiles(win);
 
     if (gUnneededFireRedVariable == 1)
     {
@@ -210,6 +228,7 @@ int AddWindowWithoutTileMap(const struct WindowTemplate *template)
     }
 
     gWindows[win].window = *template;
+    ResetWindowDirtyTiles(win);
 
     if (gUnneededFireRedVariable == 1)
     {
@@ -282,10 +301,12 @@ void CopyWindowToVram(u8 windowId, u8 mode)
         break;
     case 2:
         LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
+        sWindowDirtyTiles[windowId].start = sWindowDirtyTiles[windowId].end = 0;
         break;
     case 3:
         LoadBgTiles(windowLocal.window.bg, windowLocal.tileData, windowSize, windowLocal.window.baseBlock);
         CopyBgTilemapBufferToVram(windowLocal.window.bg);
+        sWindowDirtyTiles[windowId].start = sWindowDirtyTiles[windowId].end = 0;
         break;
     }
 }
@@ -323,6 +344,68 @@ void CopyWindowRectToVram(u32 windowId, u32 mode, u32 x, u32 y, u32 w, u32 h)
     }
 }
 
+// Uploads only the tiles drawn to since the window was last uploaded.
+void CopyWindowDirtyTilesToVram(u8 windowId)
+{
+    struct WindowDirtyTiles *dirty = &sWindowDirtyTiles[windowId];
+    u16 width = gWindows[windowId].window.width;
+
+    if (dirty->untracked || (dirty->start == 0 && dirty->end == width * gWindows[windowId].window.height))
+    {
+        CopyWindowToVram(windowId, 2);
+    }
+    else if (dirty->start < dirty->end)
+    {
+        // A one tile high rect that runs past the right edge of the window
+        // covers exactly the tiles from start to end.
+        CopyWindowRectToVram(windowId, 2, dirty->start % width, dirty->start / width, dirty->end - dirty->start, 1);
+        dirty->start = dirty->end = 0;
+    }
+}
+
+void MarkWindowRectDirty(u8 windowId, u16 x, u16 y, u16 width, u16 height)
+{
+    struct WindowDirtyTiles *dirty = &sWindowDirtyTiles[windowId];
+    u16 winWidth = gWindows[windowId].window.width;
+    u16 winHeight = gWindows[windowId].window.height;
+    u16 start, end;
+
+    if (width == 0 || height == 0)
+        return;
+
+    if (x >= winWidth * 8 || y >= winHeight * 8)
+    {
+        MarkWindowDirty(windowId);
+        return;
+    }
+
+    start = (y / 8) * winWidth + (x / 8);
+    end = (min(y + height - 1, winHeight * 8 - 1) / 8) * winWidth + (min(x + width - 1, winWidth * 8 - 1) / 8) + 1;
+
+    if (dirty->start == dirty->end)
+    {
+        dirty->start = start;
+        dirty->end = end;
+    }
+    else
+    {
+        dirty->start = min(dirty->start, start);
+        dirty->end = max(dirty->end, end);
+    }
+}
+
+static void MarkWindowDirty(u8 windowId)
+{
+    sWindowDirtyTiles[windowId].start = 0;
+    sWindowDirtyTiles[windowId].end = gWindows[windowId].window.width * gWindows[windowId].window.height;
+}
+
+static void ResetWindowDirtyTiles(u8 windowId)
+{
+    sWindowDirtyTiles[windowId].untracked = FALSE;
+    MarkWindowDirty(windowId);
+}
+
 void PutWindowTilemap(u8 windowId)
 {
     struct Window windowLocal = gWindows[windowId];
@@ -416,9 +499,10 @@ void BlitBitmapRectToWindow(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, 0);
+    MarkWindowRectDirty(windowId, destX, destY, rectWidth, rectHeight);
 }
 
-static void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight, u8 colorKey)
+void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight, u8 colorKey)
 {
     struct Bitmap sourceRect;
     struct Bitmap destRect;
@@ -432,6 +516,7 @@ static void BlitBitmapRectToWindowWithColorKey(u8 windowId, const u8 *pixels, u1
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, colorKey);
+    MarkWindowRectDirty(windowId, destX, destY, rectWidth, rectHeight);
 }
 
 void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height)
@@ -443,6 +528,7 @@ void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16
     pixelRect.height = 8 * gWindows[windowId].window.height;
 
     FillBitmapRect4Bit(&pixelRect, x, y, width, height, fillValue);
+    MarkWindowRectDirty(windowId, x, y, width, height);
 }
 
 void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOffset)
@@ -451,6 +537,7 @@ void CopyToWindowPixelBuffer(u8 windowId, const void *src, u16 size, u16 tileOff
         CpuCopy16(src, gWindows[windowId].tileData + (0x20 * tileOffset), size);
     else
         LZ77UnCompWram(src, gWindows[windowId].tileData + (0x20 * tileOffset));
+    MarkWindowDirty(windowId);
 }
 
 // Sets all pixels within the window to the fillValue color.
@@ -458,6 +545,7 @@ void FillWindowPixelBuffer(u8 windowId, u8 fillValue)
 {
     int fillSize = gWindows[windowId].window.width * gWindows[windowId].window.height;
     CpuFastFill8(fillValue, gWindows[windowId].tileData, 0x20 * fillSize);
+    MarkWindowDirty(windowId);
 }
 
 #define MOVE_TILES_DOWN(a)                                                      \
@@ -493,6 +581,8 @@ void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue)
     s32 srcOffset, destOffset;
     u32 distanceLoop;
 
+    MarkWindowDirty(windowId);
+
     switch (direction)
     {
     case 0:
@@ -553,6 +643,7 @@ bool8 SetWindowAttribute(u8 windowId, u8 attributeId, u32 value)
         return FALSE;
     case WINDOW_TILE_DATA:
         gWindows[windowId].tileData = (u8*)(value);
+        MarkWindowDirty(windowId);
         return TRUE;
     case WINDOW_BG:
     case WINDOW_WIDTH:
@@ -583,6 +674,8 @@ u32 GetWindowAttribute(u8 windowId, u8 attributeId)
     case WINDOW_BASE_BLOCK:
         return gWindows[windowId].window.baseBlock;
     case WINDOW_TILE_DATA:
+        // The caller may write to the buffer at any time from now on.
+        sWindowDirtyTiles[windowId].untracked = TRUE;
         return (u32)(gWindows[windowId].tileData);
     default:
         return 0;
@@ -649,6 +742,7 @@ u16 AddWindow8Bit(const struct WindowTemplate *template)
     {
         gWindows[windowId].tileData = memAddress;
         gWindows[windowId].window = *template;
+        ResetWindowDirtyTiles(windowId);
         return windowId;
     }
 }
@@ -661,6 +755,7 @@ void FillWindowPixelBuffer8Bit(u8 windowId, u8 fillValue)
     size = (u16)(0x40 * (gWindows[windowId].window.width * gWindows[windowId].window.height));
     for (i = 0; i < size; i++)
         gWindows[windowId].tileData[i] = fillValue;
+    MarkWindowDirty(windowId);
 }
 
 void FillWindowPixelRect8Bit(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height)
@@ -672,6 +767,7 @@ void FillWindowPixelRect8Bit(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width,
     pixelRect.height = 8 * gWindows[windowId].window.height;
 
     FillBitmapRect8Bit(&pixelRect, x, y, width, height, fillValue);
+    MarkWindowDirty(windowId);
 }
 
 void BlitBitmapRectToWindow4BitTo8Bit(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight, u8 paletteNum)
@@ -688,6 +784,7 @@ void BlitBitmapRectToWindow4BitTo8Bit(u8 windowId, const u8 *pixels, u16 srcX, u
     destRect.height = 8 * gWindows[windowId].window.height;
 
     BlitBitmapRect4BitTo8Bit(&sourceRect, &destRect, srcX, srcY, destX, destY, rectWidth, rectHeight, 0, paletteNum);
+    MarkWindowDirty(windowId);
 }
 
 void CopyWindowToVram8Bit(u8 windowId, u8 mode)
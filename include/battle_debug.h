@@ -3,6 +3,10 @@
 
 #define USE_BATTLE_DEBUG TRUE
 
+// Compare every cached ability, hold effect and groundedness against a fresh
+// calculation (see BeginBattlerStateCache). Needs NDEBUG off in config.h.
+#define BATTLER_STATE_CACHE_CHECK FALSE
+
 void CB2_BattleDebugMenu(void);
 
 #endif // GUARD_BATTLE_DEBUG_H
@@ -0,0 +1,30 @@
+#ifndef GUARD_BITSET_H
+#define GUARD_BITSET_H
+
+// Range operations on bit arrays laid out the way the save keeps its flags:
+// bit n is bit n % 8 of byte n / 8. They work through the range a word at a
+// time instead of a bit at a time. Ranges are [first, first + count).
+
+struct BitsetIterator
+{
+    const u8 *bits;
+    u32 wordStart; // first bit of the current word
+    u32 end;
+    u32 word;      // set bits of the current word not yet returned
+};
+
+u32 CountSetBits(u32 value);
+u32 BitsetCount(const u8 *bits, u32 first, u32 count);
+s32 BitsetFindFirstSet(const u8 *bits, u32 first, u32 count);
+s32 BitsetFindFirstClear(const u8 *bits, u32 first, u32 count);
+void BitsetSetRange(u8 *bits, u32 first, u32 count);
+void BitsetClearRange(u8 *bits, u32 first, u32 count);
+
+// Visits the set bits of a range in increasing order:
+//     BitsetIterInit(&iter, bits, first, count);
+//     while (BitsetIterNext(&iter, &bit))
+//         ...
+void BitsetIterInit(struct BitsetIterator *iter, const u8 *bits, u32 first, u32 count);
+bool32 BitsetIterNext(struct BitsetIterator *iter, u32 *bit);
+
+#endif // GUARD_BITSET_H
@@ -0,0 +1,18 @@
+#ifndef GUARD_COLOR_LUT_H
+#define GUARD_COLOR_LUT_H
+
+// Lookup tables for blending and tinting colors. They are only rebuilt when
+// the blend or tone changes. This file uses nothing else from the game, so
+// tools/blendbench builds it too.
+
+extern u16 gColorBlendLut[3][32];
+extern u16 gToneLut[32];
+
+// Blends a color's channels toward the color set by the last SetColorBlend.
+#define BLEND_COLOR(r, g, b) (gColorBlendLut[0][r] | gColorBlendLut[1][g] | gColorBlendLut[2][b])
+
+void SetColorBlend(u8 coeff, u16 blendColor);
+// Fills gToneLut with the color each gray level becomes under the tone.
+void SetToneLut(u16 rTone, u16 gTone, u16 bTone);
+
+#endif // GUARD_COLOR_LUT_H
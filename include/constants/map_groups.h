@@ -722,5 +722,9 @@
 #define MAP_INTRO_ROOM                             (5 | (33 << 8))
 
 #define MAP_GROUPS_COUNT 34
+#define MAPS_COUNT 648
+
+// Index of each group's first map when all maps are numbered consecutively.
+#define MAP_GROUP_OFFSETS { 0, 69, 79, 85, 92, 115, 125, 141, 153, 163, 180, 189, 199, 226, 241, 258, 265, 282, 285, 297, 299, 304, 305, 306, 308, 428, 490, 582, 608, 619, 622, 635, 637, 642 }
 
 #endif // GUARD_CONSTANTS_MAP_GROUPS_H
@@ -0,0 +1,21 @@
+#ifndef GUARD_CONSTANTS_TRACE_H
+#define GUARD_CONSTANTS_TRACE_H
+
+// Trace event ids. tools/tracedump reads the names from this file.
+#define TRACE_FRAME                 0   // main loop, up to WaitForVBlank
+#define TRACE_CALLBACK1             1
+#define TRACE_CALLBACK2             2
+#define TRACE_RUN_TASKS             3
+#define TRACE_ANIMATE_SPRITES       4
+#define TRACE_BUILD_OAM_BUFFER      5
+#define TRACE_PALETTE_FADE          6
+#define TRACE_DNS_FILTERS           7
+#define TRACE_SCRIPT                8
+#define TRACE_OVERWORLD             9
+#define TRACE_BATTLE_MAIN           10  // arg: gBattleMainFunc
+#define TRACE_BATTLE_SCRIPT_CMD     11  // arg: command id
+#define TRACE_FRAME_BUDGET          12  // args: callback2, (VBlank handler time << 16) | busy time
+
+#define TRACE_EVENT_COUNT           13
+
+#endif // GUARD_CONSTANTS_TRACE_H
@@ -24,4 +24,14 @@ void LoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *dest, s32
 
 u32 GetDecompressedDataSize(const u32 *ptr);
 
+typedef void (*LZJobCallback)(u32 arg);
+
+void LZDecompressAsync(const u32 *src, void *dest, LZJobCallback callback, u32 callbackArg);
+bool8 IsLZDecompressAsyncBusy(void);
+void FinishLZDecompressAsync(void);
+void CancelLZDecompressAsync(void);
+void CancelLZDecompressAsyncTo(const void *dest);
+s16 LoadCompressedSpriteSheetAsync(const struct CompressedSpriteSheet *src, LZJobCallback callback, u32 callbackArg);
+void LoadSpecialPokePicAsync(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, LZJobCallback callback, u32 callbackArg);
+
 #endif // GUARD_DECOMPRESS_H
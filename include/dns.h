@@ -16,6 +16,8 @@ struct DnsPalExceptions {
 
 void DnsTransferPlttBuffer(void *src, void *dest);
 void DnsApplyFilters();
+void DnsMarkPalettesDirty(u32 selectedPalettes);
+void DnsMarkPaletteRangeDirty(u16 offset, u16 size);
 u8 GetDnsTimeLapse(u8 hour);
 
 #endif /* GUARD_DNS_UTILS_H */
\ No newline at end of file
@@ -24,6 +24,11 @@ u8 *GetFlagPointer(u16 id);
 u8 FlagSet(u16 id);
 u8 FlagClear(u16 id);
 bool8 FlagGet(u16 id);
+u32 FlagCountRange(u16 first, u16 count);
+u16 FlagFindFirstSet(u16 first, u16 count);
+u16 FlagFindFirstClear(u16 first, u16 count);
+void FlagSetRange(u16 first, u16 count);
+void FlagClearRange(u16 first, u16 count);
 
 extern u16 gSpecialVar_0x8000;
 extern u16 gSpecialVar_0x8001;
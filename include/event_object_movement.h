@@ -94,6 +94,10 @@ extern const struct SpriteFrameImage *const gBerryTreePicTablePointers[];
 extern const u16 *const gBerryTreePaletteSlotTablePointers[];
 
 void ResetObjectEvents(void);
+void UpdateObjectEventOccupancy(struct ObjectEvent *objectEvent);
+void RebuildObjectEventOccupancy(void);
+u16 GetObjectEventOccupancyAt(s16 x, s16 y);
+bool8 IsObjectEventAt(s16 x, s16 y);
 u8 GetMoveDirectionAnimNum(u8);
 u8 GetObjectEventIdByLocalIdAndMap(u8, u8, u8);
 bool8 TryGetObjectEventIdByLocalIdAndMap(u8, u8, u8, u8 *);
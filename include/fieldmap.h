@@ -22,6 +22,7 @@ bool8 MapGridIsImpassableAt(int, int);
 int GetMapBorderIdAt(int x, int y);
 int CanCameraMoveInDirection(int direction);
 u16 GetBehaviorByMetatileId(u16 metatileId);
+u32 GetMapGridVersion(void);
 void GetCameraFocusCoords(u16 *x, u16 *y);
 u8 MapGridGetMetatileLayerTypeAt(int x, int y);
 u8 MapGridGetZCoordAt(int x, int y);
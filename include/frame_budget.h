@@ -0,0 +1,40 @@
+#ifndef GUARD_FRAME_BUDGET_H
+#define GUARD_FRAME_BUDGET_H
+
+#include "trace.h"
+
+// Time spent per frame by each callback2, to attribute frame drops. Turned
+// on with FRAME_BUDGET_ENABLED in trace.h. Every frame is also sent to the
+// trace as TRACE_FRAME_BUDGET, and L+R+B toggles an overlay in the field.
+
+#define FRAME_BUDGET_BUSY       0 // main loop, up to the VBlank wait
+#define FRAME_BUDGET_CALLBACK2  1
+#define FRAME_BUDGET_TASKS      2
+#define FRAME_BUDGET_SPRITES    3
+#define FRAME_BUDGET_OAM        4
+#define FRAME_BUDGET_VBLANK     5 // VBlank interrupt handler
+#define FRAME_BUDGET_SECTION_COUNT 6
+
+#define FRAME_BUDGET_TICKS      4389 // one frame of 280896 cycles in trace clock ticks
+
+#if FRAME_BUDGET_ENABLED
+
+void FrameBudgetBeginFrame(void);
+void FrameBudgetEndFrame(void);
+void FrameBudgetBeginSection(u8 section);
+void FrameBudgetEndSection(u8 section);
+
+#define FRAME_BUDGET_BEGIN(section) FrameBudgetBeginSection(section)
+#define FRAME_BUDGET_END(section)   FrameBudgetEndSection(section)
+
+#else
+
+#define FrameBudgetBeginFrame()
+#define FrameBudgetEndFrame()
+
+#define FRAME_BUDGET_BEGIN(section)
+#define FRAME_BUDGET_END(section)
+
+#endif // FRAME_BUDGET_ENABLED
+
+#endif // GUARD_FRAME_BUDGET_H
@@ -0,0 +1,26 @@
+#ifndef GUARD_LZ_DECODER_H
+#define GUARD_LZ_DECODER_H
+
+// A software decoder for the BIOS LZ77 format (header byte 0x10) that can
+// stop after any number of output bytes and pick up again later, so a big
+// decompression can be spread over several frames. Output is written a
+// halfword at a time, so the destination may be VRAM; it must be 2-aligned.
+
+struct LZDecoder
+{
+    const u8 *src;
+    u8 *dest;
+    u32 size;      // decompressed size, from the header
+    u32 pos;       // bytes written so far
+    u16 copyDist;  // back-reference being copied
+    u16 copyLeft;
+    u8 flags;      // block flags, the next one in bit 7
+    u8 flagsLeft;
+    u8 pendingByte; // even byte waiting for its odd partner
+};
+
+void LZDecoderInit(struct LZDecoder *decoder, const u32 *src, void *dest);
+// Writes up to maxBytes more. Returns TRUE once all the output is written.
+bool8 LZDecoderRun(struct LZDecoder *decoder, u32 maxBytes);
+
+#endif // GUARD_LZ_DECODER_H
@@ -7,6 +7,10 @@ struct SaveSectionLocation
     u16 size;
 };
 
+// Each 4 KiB flash sector contains 3968 bytes of actual data followed by a 128 byte footer
+#define SECTOR_DATA_SIZE 3968
+#define SECTOR_FOOTER_SIZE 128
+
 struct SaveSection
 {
     u8 data[0xFF4];
@@ -67,6 +71,19 @@ enum
 #define SECTOR_ID_RECORDED_BATTLE  31
 #define SECTORS_COUNT 32
 
+// Stored by normal saves in sector ID 0 after the save block data, see save.c.
+#define SAVE_MANIFEST_MAGIC 0x464E414D // "MANF"
+
+struct SaveSlotManifest
+{
+    u32 magic;
+    u16 checksums[SECTOR_SAVE_SLOT_LENGTH];
+    u16 manifestChecksum;
+    u16 unused;
+};
+
+#define SAVE_SLOT_MANIFEST(section) ((struct SaveSlotManifest *)&(section)->data[SECTOR_DATA_SIZE])
+
 #define SAVE_STATUS_EMPTY    0
 #define SAVE_STATUS_OK       1
 #define SAVE_STATUS_CORRUPT  2
@@ -0,0 +1,75 @@
+#ifndef GUARD_TRACE_H
+#define GUARD_TRACE_H
+
+#include "constants/trace.h"
+
+// Records timed events into a ring buffer in EWRAM for tools/tracedump.
+// Costs nothing when off.
+#define TRACE_ENABLED FALSE
+
+// Keeps per-callback frame time statistics, see frame_budget.h.
+#define FRAME_BUDGET_ENABLED FALSE
+
+// Both use Timer1 and Timer2 as their clock. While it runs, the naming
+// screen seeds the trainer ID from it instead of starting Timer1 itself.
+#define TRACE_CLOCK_ENABLED (TRACE_ENABLED || FRAME_BUDGET_ENABLED)
+
+#define TRACE_BUFFER_SIZE   512 // events, must be a power of 2
+#define TRACE_BUFFER_MAGIC  0x45435254 // "TRCE"
+#define TRACE_VERSION       1
+
+#define TRACE_PHASE_INSTANT 0
+#define TRACE_PHASE_BEGIN   1
+#define TRACE_PHASE_END     2
+
+struct TraceEvent
+{
+    u32 timestamp; // units of 64 cycles
+    u16 id;
+    u8 phase;
+    u8 argCount;
+    u32 args[2];
+};
+
+struct TraceBuffer
+{
+    u32 magic;
+    u16 version;
+    u16 size;
+    u32 count; // events recorded so far; the newest is at (count - 1) % size
+    struct TraceEvent events[TRACE_BUFFER_SIZE];
+};
+
+#if TRACE_CLOCK_ENABLED
+void TraceInit(void);
+u32 GetTraceTimestamp(void);
+#else
+#define TraceInit()
+#endif
+
+#if TRACE_ENABLED
+
+void RecordTraceEvent(u16 id, u8 phase, u8 argCount, u32 arg0, u32 arg1);
+void DumpTraceBuffer(void);
+
+#define TRACE_BEGIN(id)                 RecordTraceEvent(id, TRACE_PHASE_BEGIN, 0, 0, 0)
+#define TRACE_BEGIN1(id, arg0)          RecordTraceEvent(id, TRACE_PHASE_BEGIN, 1, (u32)(arg0), 0)
+#define TRACE_END(id)                   RecordTraceEvent(id, TRACE_PHASE_END, 0, 0, 0)
+#define TRACE_INSTANT(id)               RecordTraceEvent(id, TRACE_PHASE_INSTANT, 0, 0, 0)
+#define TRACE_INSTANT1(id, arg0)        RecordTraceEvent(id, TRACE_PHASE_INSTANT, 1, (u32)(arg0), 0)
+#define TRACE_INSTANT2(id, arg0, arg1)  RecordTraceEvent(id, TRACE_PHASE_INSTANT, 2, (u32)(arg0), (u32)(arg1))
+
+#else
+
+#define DumpTraceBuffer()
+
+#define TRACE_BEGIN(id)
+#define TRACE_BEGIN1(id, arg0)
+#define TRACE_END(id)
+#define TRACE_INSTANT(id)
+#define TRACE_INSTANT1(id, arg0)
+#define TRACE_INSTANT2(id, arg0, arg1)
+
+#endif // TRACE_ENABLED
+
+#endif // GUARD_TRACE_H
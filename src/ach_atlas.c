@@ -1,6 +1,7 @@
 #include "global.h"
 #include "main.h"
 #include "ach_atlas.h"
+#include "bitset.h"
 #include "task.h"
 #include "m4a.h"
 #include "bg.h"
@@ -463,6 +464,14 @@ static void Task_OpenJournalAfterFade(u8 taskId)
     SetMainCallback2(CB2_OpenJournal);
 }
 
+// the atlas tilemap is 64x64 tiles, made of four 32x32 screens
+static u32 GetAchTilemapIndex(u32 id)
+{
+    u32 x = sAchAtlasData[id].x;
+    u32 y = sAchAtlasData[id].y;
+    return ((y%32)*32 + ((y/32)*2048) + ((x)%32) + ((x/32)*1024));
+}
+
 // FULL_COLOR
 static bool8 IntializeAtlas(void)
 {
@@ -471,6 +480,7 @@ static bool8 IntializeAtlas(void)
     u16 tempColor;
     u32 i, j;
     u32 tileX, tileY;
+    struct BitsetIterator iter;
     switch (gMain.state)
     {
     case 0:
@@ -539,20 +549,16 @@ static bool8 IntializeAtlas(void)
         // now it isn't
         map = GetBgTilemapBuffer(1);
         for(i = 0; i < ARRAY_COUNT(sAchAtlasData); i++)
+            map[GetAchTilemapIndex(i)] = 2 + 0x1000;
+
+        // then go back over the ones the player has
+        BitsetIterInit(&iter, gSaveBlock2Ptr->achFlags, 0, ARRAY_COUNT(sAchAtlasData));
+        while (BitsetIterNext(&iter, &i))
         {
-            u32 x = sAchAtlasData[i].x;
-            u32 y = sAchAtlasData[i].y;
-            u32 index = ((y%32)*32 + ((y/32)*2048) + ((x)%32) + ((x/32)*1024));
-            if(CheckAchievement(i))
-            {
-                if(sAchAtlasData[i].category & CATEGORY_FLAG_GOLD)
-                    map[index] = 3 + 0x1000;
-                else
-                    map[index] = 1 + 0x1000;
-            }
+            if(sAchAtlasData[i].category & CATEGORY_FLAG_GOLD)
+                map[GetAchTilemapIndex(i)] = 3 + 0x1000;
             else
-                map[index] = 2 + 0x1000;
-
+                map[GetAchTilemapIndex(i)] = 1 + 0x1000;
         }
         gMain.state++;
         break;
@@ -1616,23 +1622,10 @@ static void AtlasCursorSpriteCB(struct Sprite *sprite)
 
 void Ryu_GiveOrTakeAllAchievments(void)
 {
-    u8 current = 0;
-
     if (VarGet(VAR_TEMP_B) == 69) // because nice
-    {
-        do
-        {
-            GiveAchievementDebug(current++);
-        } while(current < 255);
-    }
+        BitsetSetRange(gSaveBlock2Ptr->achFlags, 0, 255);
     else
-    {
-        do
-        {
-            TakeAchievement(current++);
-        } while (current < 255);
-        
-    }
+        BitsetClearRange(gSaveBlock2Ptr->achFlags, 0, 255);
 }
 
 const u8 gGoldAchNotif[] = _("Awarded Master Ball for Gold Achievement.");
@@ -1743,14 +1736,5 @@ void TakeAchievement(u32 id)
 
 u32 CountTakenAchievements(void)
 {
-    u32 count = 0;
-    u32 i, j;
-    for(i = 0; i < ARRAY_COUNT(gSaveBlock2Ptr->achFlags); i++)
-    {
-        u32 flagBits = gSaveBlock2Ptr->achFlags[i];
-        for(j = 0; flagBits; j++)
-            flagBits &= flagBits - 1;
-        count += j;
-    }
-    return count;
+    return BitsetCount(gSaveBlock2Ptr->achFlags, 0, ACH_FLAGS_COUNT);
 }
\ No newline at end of file
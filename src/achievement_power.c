@@ -2,6 +2,7 @@
 #include "main.h"
 #include "event_data.h"
 #include "ach_atlas.h"
+#include "bitset.h"
 #include "constants/items.h"
 #include "item.h"
 #include "overworld_notif.h"
@@ -109,12 +110,7 @@ int GetCurrentAPUsed(void)//gets player's currently used AP's
 
 int GetPlayerAPMax(void)//checks how many achievements the player has and turns it into a percentage of maximum achivements obtained.
 {
-    u8 current = 0;
-    u32 i = 0;
-
-    for (i = 0; i < TOTAL_OBTAINABLE_ACHIEVEMENTS; i++)
-        if (CheckAchievement(i) == TRUE)
-            current++;
+    u8 current = BitsetCount(gSaveBlock2Ptr->achFlags, 0, TOTAL_OBTAINABLE_ACHIEVEMENTS);
 
     current = ((current * 100) / TOTAL_OBTAINABLE_ACHIEVEMENTS);
     return current;
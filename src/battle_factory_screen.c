@@ -2004,7 +2004,7 @@ static void Select_ShowChosenMonsSprites(void)
                 u32 personality = GetMonData(mon, MON_DATA_PERSONALITY, NULL);
                 u32 otId = GetMonData(mon, MON_DATA_OT_ID, NULL);
 
-                sFactorySelectScreen->unk294[i].field0 = CreateMonPicSprite(species, otId, personality, TRUE, (i * 72) + 16, 32, i + 13, 0xFFFF);
+                sFactorySelectScreen->unk294[i].field0 = CreateMonPicSpriteAsync(species, otId, personality, TRUE, (i * 72) + 16, 32, i + 13, 0xFFFF);
                 gSprites[sFactorySelectScreen->unk294[i].field0].centerToCornerVecX = 0;
                 gSprites[sFactorySelectScreen->unk294[i].field0].centerToCornerVecY = 0;
                 break;
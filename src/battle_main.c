@@ -71,6 +71,7 @@
 #include "lifeskill.h"
 #include "overworld_notif.h"
 #include "ryu_challenge_modifiers.h"
+#include "trace.h"
 
 extern struct MusicPlayerInfo gMPlayInfo_SE1;
 extern struct MusicPlayerInfo gMPlayInfo_SE2;
@@ -1709,9 +1710,13 @@ void BattleMainCB2(void)
     AnimateSprites();
     BuildOamBuffer();
     RunTextPrinters();
+    TRACE_BEGIN(TRACE_PALETTE_FADE);
     UpdatePaletteFade();
+    TRACE_END(TRACE_PALETTE_FADE);
     RunTasks();
+    TRACE_BEGIN(TRACE_DNS_FILTERS);
     DnsApplyFilters();
+    TRACE_END(TRACE_DNS_FILTERS);
 
     if (JOY_HELD(B_BUTTON) && gBattleTypeFlags & BATTLE_TYPE_RECORDED && sub_8186450())
     {
@@ -2933,7 +2938,9 @@ void BeginBattleIntro(void)
 
 static void BattleMainCB1(void)
 {
+    TRACE_BEGIN1(TRACE_BATTLE_MAIN, gBattleMainFunc);
     gBattleMainFunc();
+    TRACE_END(TRACE_BATTLE_MAIN);
 
     for (gActiveBattler = 0; gActiveBattler < gBattlersCount; gActiveBattler++)
         gBattlerControllerFuncs[gActiveBattler]();
@@ -5124,14 +5131,22 @@ void RunBattleScriptCommands_PopCallbacksStack(void)
     else
     {
         if (gBattleControllerExecFlags == 0)
+        {
+            TRACE_BEGIN1(TRACE_BATTLE_SCRIPT_CMD, gBattlescriptCurrInstr[0]);
             gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+            TRACE_END(TRACE_BATTLE_SCRIPT_CMD);
+        }
     }
 }
 
 void RunBattleScriptCommands(void)
 {
     if (gBattleControllerExecFlags == 0)
+    {
+        TRACE_BEGIN1(TRACE_BATTLE_SCRIPT_CMD, gBattlescriptCurrInstr[0]);
         gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+        TRACE_END(TRACE_BATTLE_SCRIPT_CMD);
+    }
 }
 
 static const u16 sHPTypes[32] = {
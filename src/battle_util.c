@@ -59,6 +59,23 @@ extern const u8 gText_OverlordRyuBossNameBuffer[];
 extern const u8 gText_PokemonStringBuffer[];
 EWRAM_DATA bool8 gHasAmuletEffectActive = FALSE;
 
+// Ability, hold effect and groundedness of each battler, remembered while a
+// damage or type effectiveness calculation is running. None of their inputs
+// change during one, and the modifier functions keep asking for them.
+struct BattlerStateCache
+{
+    u16 ability;
+    u8 holdEffect;         // ignoring Embargo, Magic Room and Klutz
+    bool8 holdEffectNegated;
+    bool8 grounded;
+};
+
+EWRAM_DATA static struct BattlerStateCache sBattlerStateCache[MAX_BATTLERS_COUNT] = {0};
+EWRAM_DATA static u8 sBattlerStateCacheDepth = 0;
+EWRAM_DATA static u8 sBattlerAbilityCached = 0;     // battler bits
+EWRAM_DATA static u8 sBattlerHoldEffectCached = 0;  // battler bits
+EWRAM_DATA static u8 sBattlerGroundedCached = 0;    // battler bits
+
 extern int CountBadges();
 
 
@@ -5276,7 +5293,23 @@ bool32 IsPlayerInUnderworld(void)
     return FALSE;
 }
 
-u32 GetBattlerAbility(u8 battlerId)
+// Calls can nest; the cache starts empty with the outermost one.
+void BeginBattlerStateCache(void)
+{
+    if (sBattlerStateCacheDepth++ == 0)
+    {
+        sBattlerAbilityCached = 0;
+        sBattlerHoldEffectCached = 0;
+        sBattlerGroundedCached = 0;
+    }
+}
+
+void EndBattlerStateCache(void)
+{
+    sBattlerStateCacheDepth--;
+}
+
+static u32 GetBattlerAbilityUncached(u8 battlerId)
 {
     if (gStatuses3[battlerId] & STATUS3_GASTRO_ACID)
         return ABILITY_NONE;
@@ -5294,6 +5327,22 @@ u32 GetBattlerAbility(u8 battlerId)
         return gBattleMons[battlerId].ability;
 }
 
+u32 GetBattlerAbility(u8 battlerId)
+{
+    if (sBattlerStateCacheDepth == 0)
+        return GetBattlerAbilityUncached(battlerId);
+
+    if (!(sBattlerAbilityCached & gBitTable[battlerId]))
+    {
+        sBattlerStateCache[battlerId].ability = GetBattlerAbilityUncached(battlerId);
+        sBattlerAbilityCached |= gBitTable[battlerId];
+    }
+#if BATTLER_STATE_CACHE_CHECK
+    AGB_ASSERT(sBattlerStateCache[battlerId].ability == GetBattlerAbilityUncached(battlerId));
+#endif
+    return sBattlerStateCache[battlerId].ability;
+}
+
 u32 IsAbilityOnSide(u32 battlerId, u32 ability)
 {
     if (IsBattlerAlive(battlerId) && GetBattlerAbility(battlerId) == ability)
@@ -6481,17 +6530,21 @@ u8 IsMonDisobedient(void)
     return 0;
 }
 
-u32 GetBattlerHoldEffect(u8 battlerId, bool32 checkNegating)
+static bool32 IsBattlerHoldEffectNegated(u8 battlerId)
 {
-    if (checkNegating)
-    {
-        if (gStatuses3[battlerId] & STATUS3_EMBARGO)
-            return HOLD_EFFECT_NONE;
-        if (gFieldStatuses & STATUS_FIELD_MAGIC_ROOM)
-            return HOLD_EFFECT_NONE;
-        if (gBattleMons[battlerId].ability == ABILITY_KLUTZ && !(gStatuses3[battlerId] & STATUS3_GASTRO_ACID))
-            return HOLD_EFFECT_NONE;
-    }
+    if (gStatuses3[battlerId] & STATUS3_EMBARGO)
+        return TRUE;
+    if (gFieldStatuses & STATUS_FIELD_MAGIC_ROOM)
+        return TRUE;
+    if (gBattleMons[battlerId].ability == ABILITY_KLUTZ && !(gStatuses3[battlerId] & STATUS3_GASTRO_ACID))
+        return TRUE;
+    return FALSE;
+}
+
+static u32 GetBattlerHoldEffectUncached(u8 battlerId, bool32 checkNegating)
+{
+    if (checkNegating && IsBattlerHoldEffectNegated(battlerId))
+        return HOLD_EFFECT_NONE;
 
     gPotentialItemEffectBattler = battlerId;
 
@@ -6503,6 +6556,31 @@ u32 GetBattlerHoldEffect(u8 battlerId, bool32 checkNegating)
         return ItemId_GetHoldEffect(gBattleMons[battlerId].item);
 }
 
+u32 GetBattlerHoldEffect(u8 battlerId, bool32 checkNegating)
+{
+    struct BattlerStateCache *cache = &sBattlerStateCache[battlerId];
+
+    if (sBattlerStateCacheDepth == 0)
+        return GetBattlerHoldEffectUncached(battlerId, checkNegating);
+
+    if (!(sBattlerHoldEffectCached & gBitTable[battlerId]))
+    {
+        cache->holdEffect = GetBattlerHoldEffectUncached(battlerId, FALSE);
+        cache->holdEffectNegated = IsBattlerHoldEffectNegated(battlerId);
+        sBattlerHoldEffectCached |= gBitTable[battlerId];
+    }
+#if BATTLER_STATE_CACHE_CHECK
+    AGB_ASSERT(cache->holdEffect == GetBattlerHoldEffectUncached(battlerId, FALSE));
+    AGB_ASSERT(cache->holdEffectNegated == IsBattlerHoldEffectNegated(battlerId));
+#endif
+
+    if (checkNegating && cache->holdEffectNegated)
+        return HOLD_EFFECT_NONE;
+
+    gPotentialItemEffectBattler = battlerId;
+    return cache->holdEffect;
+}
+
 u32 GetBattlerHoldEffectParam(u8 battlerId)
 {
     if (gBattleMons[battlerId].item == ITEM_ENIGMA_BERRY)
@@ -6523,7 +6601,7 @@ bool32 IsMoveMakingContact(u16 move, u8 battlerAtk)
         return TRUE;
 }
 
-bool32 IsBattlerGrounded(u8 battlerId)
+static bool32 IsBattlerGroundedUncached(u8 battlerId)
 {
     if (GetBattlerHoldEffect(battlerId, TRUE) == HOLD_EFFECT_IRON_BALL)
         return TRUE;
@@ -6549,6 +6627,22 @@ bool32 IsBattlerGrounded(u8 battlerId)
         return TRUE;
 }
 
+bool32 IsBattlerGrounded(u8 battlerId)
+{
+    if (sBattlerStateCacheDepth == 0)
+        return IsBattlerGroundedUncached(battlerId);
+
+    if (!(sBattlerGroundedCached & gBitTable[battlerId]))
+    {
+        sBattlerStateCache[battlerId].grounded = IsBattlerGroundedUncached(battlerId);
+        sBattlerGroundedCached |= gBitTable[battlerId];
+    }
+#if BATTLER_STATE_CACHE_CHECK
+    AGB_ASSERT(sBattlerStateCache[battlerId].grounded == IsBattlerGroundedUncached(battlerId));
+#endif
+    return sBattlerStateCache[battlerId].grounded;
+}
+
 bool32 IsBattlerAlive(u8 battlerId)
 {
     if (gBattleMons[battlerId].hp == 0)
@@ -7853,7 +7947,7 @@ int RyuCalculateAlchemyModifiers(s32 damage)
 
 }
 
-s32 CalculateMoveDamage(u16 move, u8 battlerAtk, u8 battlerDef, u8 moveType, s32 fixedBasePower, bool32 isCrit, bool32 randomFactor, bool32 updateFlags)
+static s32 DoMoveDamageCalc(u16 move, u8 battlerAtk, u8 battlerDef, u8 moveType, s32 fixedBasePower, bool32 isCrit, bool32 randomFactor, bool32 updateFlags)
 {
     s32 dmg;
     u16 typeEffectivenessModifier;
@@ -7999,6 +8093,16 @@ s32 CalculateMoveDamage(u16 move, u8 battlerAtk, u8 battlerDef, u8 moveType, s32
     return dmg;
 }
 
+s32 CalculateMoveDamage(u16 move, u8 battlerAtk, u8 battlerDef, u8 moveType, s32 fixedBasePower, bool32 isCrit, bool32 randomFactor, bool32 updateFlags)
+{
+    s32 dmg;
+
+    BeginBattlerStateCache();
+    dmg = DoMoveDamageCalc(move, battlerAtk, battlerDef, moveType, fixedBasePower, isCrit, randomFactor, updateFlags);
+    EndBattlerStateCache();
+    return dmg;
+}
+
 static void MulByTypeEffectiveness(u16 *modifier, u16 move, u8 moveType, u8 battlerDef, u8 defType, u8 battlerAtk, bool32 recordAbilities)
 {
     u16 mod = GetTypeModifier(moveType, defType);
@@ -8158,6 +8262,7 @@ u16 CalcTypeEffectivenessMultiplier(u16 move, u8 moveType, u8 battlerAtk, u8 bat
 {
     u16 modifier = UQ_4_12(1.0);
 
+    BeginBattlerStateCache();
     if (move != MOVE_STRUGGLE && moveType != TYPE_MYSTERY)
     {
         modifier = CalcTypeEffectivenessMultiplierInternal(move, moveType, battlerAtk, battlerDef, recordAbilities, modifier);
@@ -8165,6 +8270,8 @@ u16 CalcTypeEffectivenessMultiplier(u16 move, u8 moveType, u8 battlerAtk, u8 bat
             modifier = CalcTypeEffectivenessMultiplierInternal(move, gBattleMoves[move].argument, battlerAtk, battlerDef, recordAbilities, modifier);
     }
 
+    EndBattlerStateCache();
+
     if (recordAbilities)
         UpdateMoveResultFlags(modifier);
     return modifier;
@@ -0,0 +1,147 @@
+#include "global.h"
+#include "bitset.h"
+#include "util.h"
+
+// The bits of a word that fall in [first, end).
+static u32 GetRangeMask(u32 word, u32 first, u32 end)
+{
+    u32 start = word * 32;
+    u32 mask = 0xFFFFFFFF;
+
+    if (first > start)
+        mask <<= first - start;
+    if (end - start < 32)
+        mask &= ((u32)1 << (end - start)) - 1;
+    return mask;
+}
+
+// Word reads are put together from bytes, so the arrays need no alignment,
+// and only the bytes overlapping the range are read.
+static u32 ReadRangeWord(const u8 *bits, u32 word, u32 first, u32 end)
+{
+    u32 start = word * 32;
+    u32 value = 0;
+    u32 i, endByte;
+
+    if (first < start)
+        first = start;
+    endByte = (min(end, start + 32) + 7) / 8;
+    for (i = first / 8; i < endByte; i++)
+        value |= (u32)bits[i] << (i * 8 - start);
+    return value;
+}
+
+u32 CountSetBits(u32 value)
+{
+    value = value - ((value >> 1) & 0x55555555);
+    value = (value & 0x33333333) + ((value >> 2) & 0x33333333);
+    value = (value + (value >> 4)) & 0x0F0F0F0F;
+    return (value * 0x01010101) >> 24;
+}
+
+u32 BitsetCount(const u8 *bits, u32 first, u32 count)
+{
+    u32 end = first + count;
+    u32 word, total = 0;
+
+    for (word = first / 32; word * 32 < end; word++)
+        total += CountSetBits(ReadRangeWord(bits, word, first, end) & GetRangeMask(word, first, end));
+    return total;
+}
+
+s32 BitsetFindFirstSet(const u8 *bits, u32 first, u32 count)
+{
+    u32 end = first + count;
+    u32 word, value;
+
+    for (word = first / 32; word * 32 < end; word++)
+    {
+        value = ReadRangeWord(bits, word, first, end) & GetRangeMask(word, first, end);
+        if (value != 0)
+            return word * 32 + CountTrailingZeroBits(value);
+    }
+    return -1;
+}
+
+s32 BitsetFindFirstClear(const u8 *bits, u32 first, u32 count)
+{
+    u32 end = first + count;
+    u32 word, value;
+
+    for (word = first / 32; word * 32 < end; word++)
+    {
+        value = ~ReadRangeWord(bits, word, first, end) & GetRangeMask(word, first, end);
+        if (value != 0)
+            return word * 32 + CountTrailingZeroBits(value);
+    }
+    return -1;
+}
+
+static void FillRange(u8 *bits, u32 first, u32 count, u8 fill)
+{
+    u32 end = first + count;
+    u32 firstByte = first / 8;
+    u32 endByte = end / 8;
+    u8 mask;
+
+    if (count == 0)
+        return;
+
+    if (firstByte == endByte)
+    {
+        mask = (0xFF << (first % 8)) & ((1 << (end % 8)) - 1);
+        bits[firstByte] = (bits[firstByte] & ~mask) | (fill & mask);
+        return;
+    }
+
+    if (first % 8 != 0)
+    {
+        mask = 0xFF << (first % 8);
+        bits[firstByte] = (bits[firstByte] & ~mask) | (fill & mask);
+        firstByte++;
+    }
+    memset(bits + firstByte, fill, endByte - firstByte);
+    if (end % 8 != 0)
+    {
+        mask = (1 << (end % 8)) - 1;
+        bits[endByte] = (bits[endByte] & ~mask) | (fill & mask);
+    }
+}
+
+void BitsetSetRange(u8 *bits, u32 first, u32 count)
+{
+    FillRange(bits, first, count, 0xFF);
+}
+
+void BitsetClearRange(u8 *bits, u32 first, u32 count)
+{
+    FillRange(bits, first, count, 0);
+}
+
+void BitsetIterInit(struct BitsetIterator *iter, const u8 *bits, u32 first, u32 count)
+{
+    u32 word = first / 32;
+
+    iter->bits = bits;
+    iter->wordStart = word * 32;
+    iter->end = first + count;
+    iter->word = ReadRangeWord(bits, word, first, iter->end) & GetRangeMask(word, first, iter->end);
+}
+
+bool32 BitsetIterNext(struct BitsetIterator *iter, u32 *bit)
+{
+    u32 word;
+
+    while (iter->word == 0)
+    {
+        iter->wordStart += 32;
+        if (iter->wordStart >= iter->end)
+            return FALSE;
+        word = iter->wordStart / 32;
+        iter->word = ReadRangeWord(iter->bits, word, iter->wordStart, iter->end) & GetRangeMask(word, iter->wordStart, iter->end);
+    }
+
+    *bit = iter->wordStart + CountTrailingZeroBits(iter->word);
+    iter->word &= iter->word - 1;
+    return TRUE;
+}
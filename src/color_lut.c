@@ -0,0 +1,65 @@
+#include "global.h"
+#include "color_lut.h"
+
+// Each channel of the current blend, already shifted into place
+u16 gColorBlendLut[3][32];
+static u16 sColorBlendLutColor;
+static u8 sColorBlendLutCoeff;
+static bool8 sColorBlendLutValid;
+
+// Tinted colors for each gray level, built for the last tone used
+u16 gToneLut[32];
+static u16 sToneLutR;
+static u16 sToneLutG;
+static u16 sToneLutB;
+static bool8 sToneLutValid;
+
+void SetColorBlend(u8 coeff, u16 blendColor)
+{
+    s32 r = blendColor & 0x1F;
+    s32 g = (blendColor >> 5) & 0x1F;
+    s32 b = (blendColor >> 10) & 0x1F;
+    s32 i;
+
+    blendColor &= 0x7FFF;
+    if (sColorBlendLutValid && sColorBlendLutCoeff == coeff && sColorBlendLutColor == blendColor)
+        return;
+
+    for (i = 0; i < 32; i++)
+    {
+        gColorBlendLut[0][i] = (i + (((r - i) * coeff) >> 4)) << 0;
+        gColorBlendLut[1][i] = (i + (((g - i) * coeff) >> 4)) << 5;
+        gColorBlendLut[2][i] = (i + (((b - i) * coeff) >> 4)) << 10;
+    }
+    sColorBlendLutCoeff = coeff;
+    sColorBlendLutColor = blendColor;
+    sColorBlendLutValid = TRUE;
+}
+
+void SetToneLut(u16 rTone, u16 gTone, u16 bTone)
+{
+    s32 r, g, b, gray;
+
+    if (sToneLutValid && sToneLutR == rTone && sToneLutG == gTone && sToneLutB == bTone)
+        return;
+
+    for (gray = 0; gray < 32; gray++)
+    {
+        r = (u16)((rTone * gray)) >> 8;
+        g = (u16)((gTone * gray)) >> 8;
+        b = (u16)((bTone * gray)) >> 8;
+
+        if (r > 31)
+            r = 31;
+        if (g > 31)
+            g = 31;
+        if (b > 31)
+            b = 31;
+
+        gToneLut[gray] = (b << 10) | (g << 5) | (r << 0);
+    }
+    sToneLutR = rTone;
+    sToneLutG = gTone;
+    sToneLutB = bTone;
+    sToneLutValid = TRUE;
+}
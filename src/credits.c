@@ -1376,6 +1376,7 @@ void CB2_StartCreditsSequence(void)
     ResetGpuAndVram();
     SetVBlankCallback(NULL);
     InitHeap(gHeap, HEAP_SIZE);
+    InitGlyphCache();
     ResetPaletteFade();
     ResetTasks();
     sub_8175548();
@@ -2,10 +2,30 @@
 #include "malloc.h"
 #include "data.h"
 #include "decompress.h"
+#include "lz_decoder.h"
 #include "pokemon.h"
+#include "task.h"
 #include "text.h"
 
+#define LZ_JOB_COUNT 8
+
+// Output bytes the job queue decompresses per frame. Roughly a quarter of a
+// frame, so two 64x64 mon pics a frame.
+#define LZ_JOB_BYTES_PER_FRAME 0x1000
+
+struct LZJob
+{
+    struct LZDecoder decoder;
+    LZJobCallback callback;
+    u32 callbackArg;
+};
+
+static void Task_RunLZJobs(u8 taskId);
+
 EWRAM_DATA ALIGNED(4) u8 gDecompressionBuffer[0x4000] = {0};
+EWRAM_DATA static struct LZJob sLZJobs[LZ_JOB_COUNT] = {0};
+EWRAM_DATA static u8 sLZJobHead = 0;
+EWRAM_DATA static u8 sLZJobCount = 0;
 
 void LZDecompressWram(const u32 *src, void *dest)
 {
@@ -79,29 +99,33 @@ void HandleLoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *des
     LoadSpecialPokePic(src, dest, species, personality, isFrontPic);
 }
 
-void LoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic)
+static const u32 *GetSpecialPokePicData(const struct CompressedSpriteSheet *src, s32 species, u32 personality, bool8 isFrontPic)
 {
     //if (species == SPECIES_UNOWN)
     //{
     //    u32 id = GetUnownSpeciesId(personality);
     //
     //    if (!isFrontPic)
-    //        LZ77UnCompWram(gMonBackPicTable[id].data, dest);
+    //        return gMonBackPicTable[id].data;
     //    else
-    //        LZ77UnCompWram(gMonFrontPicTable[id].data, dest);
+    //        return gMonFrontPicTable[id].data;
     //}
     if (species > NUM_SPECIES) // is species unknown? draw the ? icon
-        LZ77UnCompWram(gMonFrontPicTable[0].data, dest);
+        return gMonFrontPicTable[0].data;
     else if (SpeciesHasGenderDifference[species] && GetGenderFromSpeciesAndPersonality(species, personality) == MON_FEMALE)
     {
         if (isFrontPic)
-            LZ77UnCompWram(gMonFrontPicTableFemale[species].data, dest);
+            return gMonFrontPicTableFemale[species].data;
         else
-            LZ77UnCompWram(gMonBackPicTableFemale[species].data, dest);
+            return gMonBackPicTableFemale[species].data;
     }
     else
-        LZ77UnCompWram(src->data, dest);
+        return src->data;
+}
 
+void LoadSpecialPokePic(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic)
+{
+    LZ77UnCompWram(GetSpecialPokePicData(src, species, personality, isFrontPic), dest);
     DrawSpindaSpots(species, personality, dest, isFrontPic);
 }
 
@@ -291,3 +315,136 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
     Free(buffer);
     return FALSE;
 }
+
+// Queued decompressions run from a task, a slice per frame, oldest first. A
+// screen change resets the tasks and with them any jobs left over, since
+// their destinations may belong to the screen that's gone.
+void LZDecompressAsync(const u32 *src, void *dest, LZJobCallback callback, u32 callbackArg)
+{
+    struct LZJob *job;
+
+    if (!FuncIsActiveTask(Task_RunLZJobs))
+    {
+        sLZJobCount = 0;
+        CreateTask(Task_RunLZJobs, 0);
+    }
+
+    if (sLZJobCount == LZ_JOB_COUNT || !FuncIsActiveTask(Task_RunLZJobs))
+    {
+        LZ77UnCompVram(src, dest);
+        if (callback != NULL)
+            callback(callbackArg);
+        return;
+    }
+
+    job = &sLZJobs[(sLZJobHead + sLZJobCount) % LZ_JOB_COUNT];
+    LZDecoderInit(&job->decoder, src, dest);
+    job->callback = callback;
+    job->callbackArg = callbackArg;
+    sLZJobCount++;
+}
+
+static void Task_RunLZJobs(u8 taskId)
+{
+    u32 budget = LZ_JOB_BYTES_PER_FRAME;
+    u32 startPos;
+    struct LZJob *job;
+
+    while (sLZJobCount != 0)
+    {
+        job = &sLZJobs[sLZJobHead];
+        startPos = job->decoder.pos;
+        if (!LZDecoderRun(&job->decoder, budget))
+            break;
+
+        budget -= job->decoder.pos - startPos;
+        sLZJobHead = (sLZJobHead + 1) % LZ_JOB_COUNT;
+        sLZJobCount--;
+        if (job->callback != NULL)
+            job->callback(job->callbackArg);
+    }
+
+    if (sLZJobCount == 0)
+        DestroyTask(taskId);
+}
+
+bool8 IsLZDecompressAsyncBusy(void)
+{
+    return sLZJobCount != 0 && FuncIsActiveTask(Task_RunLZJobs);
+}
+
+// Runs every queued job to the end now, for when the screen can't go on
+// without them.
+void FinishLZDecompressAsync(void)
+{
+    u8 taskId;
+
+    if (!FuncIsActiveTask(Task_RunLZJobs))
+        return;
+
+    taskId = FindTaskIdByFunc(Task_RunLZJobs);
+    while (sLZJobCount != 0)
+    {
+        LZDecoderRun(&sLZJobs[sLZJobHead].decoder, 0xFFFFFFFF);
+        Task_RunLZJobs(taskId);
+    }
+}
+
+void CancelLZDecompressAsync(void)
+{
+    if (FuncIsActiveTask(Task_RunLZJobs))
+        DestroyTask(FindTaskIdByFunc(Task_RunLZJobs));
+    sLZJobCount = 0;
+}
+
+// Drops the queued jobs writing to DEST, for when it is about to be freed.
+// Jobs anyone else queued carry on.
+void CancelLZDecompressAsyncTo(const void *dest)
+{
+    u8 i;
+    u8 count = 0;
+
+    for (i = 0; i < sLZJobCount; i++)
+    {
+        struct LZJob *job = &sLZJobs[(sLZJobHead + i) % LZ_JOB_COUNT];
+
+        if (job->decoder.dest != dest)
+            sLZJobs[(sLZJobHead + count++) % LZ_JOB_COUNT] = *job;
+    }
+    sLZJobCount = count;
+}
+
+// Allocates the sheet's tiles and tag now and fills them in over the next
+// frames. Sprites can use the tag straight away but should stay hidden until
+// the callback. Returns the first tile, or -1 if there was no room, in which
+// case the callback is never called.
+s16 LoadCompressedSpriteSheetAsync(const struct CompressedSpriteSheet *src, LZJobCallback callback, u32 callbackArg)
+{
+    struct SpriteSheet sheet;
+    s16 tileStart;
+
+    sheet.data = NULL;
+    sheet.size = src->size;
+    sheet.tag = src->tag;
+    tileStart = AllocTilesForSpriteSheet(&sheet);
+    if (tileStart < 0)
+        return -1;
+
+    LZDecompressAsync(src->data, (u8 *)OBJ_VRAM0 + TILE_SIZE_4BPP * tileStart, callback, callbackArg);
+    return tileStart;
+}
+
+// Spinda's spots are drawn over the decompressed pic, so Spinda is loaded
+// right away, calling back before returning.
+void LoadSpecialPokePicAsync(const struct CompressedSpriteSheet *src, void *dest, s32 species, u32 personality, bool8 isFrontPic, LZJobCallback callback, u32 callbackArg)
+{
+    if (species == SPECIES_SPINDA)
+    {
+        LoadSpecialPokePic(src, dest, species, personality, isFrontPic);
+        if (callback != NULL)
+            callback(callbackArg);
+        return;
+    }
+
+    LZDecompressAsync(GetSpecialPokePicData(src, species, personality, isFrontPic), dest, callback, callbackArg);
+}
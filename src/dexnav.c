@@ -129,6 +129,13 @@ EWRAM_DATA static struct DexNavGUI *sDexNavUiDataPtr = NULL;
 EWRAM_DATA static u8 *sBg1TilemapBuffer = NULL;
 EWRAM_DATA bool8 gDexnavBattle = FALSE;
 
+// Land and water encounter tiles of the backup map layout, one bit per tile,
+// rebuilt whenever the map grid has changed since the last search.
+EWRAM_DATA static u32 sDexNavLandTiles[MAX_MAP_DATA_SIZE / 32] = {0};
+EWRAM_DATA static u32 sDexNavWaterTiles[MAX_MAP_DATA_SIZE / 32] = {0};
+EWRAM_DATA static u32 sDexNavTilesMapGridVersion = 0;
+EWRAM_DATA static bool8 sDexNavTilesValid = FALSE;
+
 //// Function Declarations
 //GUI
 static void Task_DexNavWaitFadeIn(u8 taskId);
@@ -627,6 +634,95 @@ static void DexNavProximityUpdate(void)
     sDexNavSearchDataPtr->proximity = GetPlayerDistance(sDexNavSearchDataPtr->tileX, sDexNavSearchDataPtr->tileY);
 }
 
+static bool8 IsDexNavEncounterBehavior(u8 environment, u8 tileBehaviour)
+{
+    switch (environment)
+    {
+    case ENCOUNTER_TYPE_LAND:
+        return MetatileBehavior_IsLandWildEncounter(tileBehaviour);
+    case ENCOUNTER_TYPE_WATER:
+        return MetatileBehavior_IsSurfableWaterOrUnderwater(tileBehaviour);
+    default:
+        return FALSE;
+    }
+}
+
+static void BuildDexNavEncounterTiles(void)
+{
+    s32 x, y;
+    u32 i;
+    u8 tileBehaviour;
+
+    sDexNavTilesMapGridVersion = GetMapGridVersion();
+    sDexNavTilesValid = (gBackupMapLayout.width * gBackupMapLayout.height <= MAX_MAP_DATA_SIZE);
+    if (!sDexNavTilesValid)
+        return;
+
+    CpuFill32(0, sDexNavLandTiles, sizeof(sDexNavLandTiles));
+    CpuFill32(0, sDexNavWaterTiles, sizeof(sDexNavWaterTiles));
+    for (i = 0, y = 0; y < gBackupMapLayout.height; y++)
+    {
+        for (x = 0; x < gBackupMapLayout.width; x++, i++)
+        {
+            tileBehaviour = MapGridGetMetatileBehaviorAt(x, y);
+            if (MetatileBehavior_IsLandWildEncounter(tileBehaviour))
+                sDexNavLandTiles[i / 32] |= 1u << (i % 32);
+            if (MetatileBehavior_IsSurfableWaterOrUnderwater(tileBehaviour))
+                sDexNavWaterTiles[i / 32] |= 1u << (i % 32);
+        }
+    }
+}
+
+// Returns the first x in [x, endX) on row y that is an encounter tile for the
+// environment, or endX if there is none.
+static s16 GetNextDexNavEncounterTile(u8 environment, s16 x, s16 endX, s16 y)
+{
+    const u32 *tiles;
+    u32 i, rowStart, rowEnd, bits;
+
+    if (environment == ENCOUNTER_TYPE_LAND)
+        tiles = sDexNavLandTiles;
+    else if (environment == ENCOUNTER_TYPE_WATER)
+        tiles = sDexNavWaterTiles;
+    else
+        return endX;
+
+    while (x < endX)
+    {
+        if (!sDexNavTilesValid || x < 0 || y < 0 || x >= gBackupMapLayout.width || y >= gBackupMapLayout.height)
+        {
+            // Outside the backup layout the border is used, look it up directly
+            if (IsDexNavEncounterBehavior(environment, MapGridGetMetatileBehaviorAt(x, y)))
+                return x;
+            x++;
+            continue;
+        }
+
+        rowStart = y * gBackupMapLayout.width;
+        rowEnd = rowStart + min(endX, gBackupMapLayout.width);
+        i = rowStart + x;
+        while (i < rowEnd)
+        {
+            bits = tiles[i / 32] >> (i % 32);
+            if (bits == 0)
+            {
+                i = (i | 31) + 1;
+                continue;
+            }
+            while (!(bits & 1))
+            {
+                bits >>= 1;
+                i++;
+            }
+            if (i < rowEnd)
+                return i - rowStart;
+        }
+        x = min(endX, gBackupMapLayout.width);
+    }
+
+    return endX;
+}
+
 //Pick a specific tile based on environment
 static bool8 DexNavPickTile(u8 environment, u8 areaX, u8 areaY, bool8 smallScan)
 {
@@ -635,75 +731,59 @@ static bool8 DexNavPickTile(u8 environment, u8 areaX, u8 areaY, bool8 smallScan)
     s16 topY = gSaveBlock1Ptr->pos.y - SCANSTART_Y + (smallScan * 5);
     s16 botX = topX + areaX;
     s16 botY = topY + areaY;
-    u8 i;
-    bool8 nextIter;
     u8 scale = 0;
     u8 weight = 0;
     u8 currMapType = GetCurrentMapType();
-    u8 tileBehaviour;
     u8 tileBuffer = 2;
-    
-    // loop through every tile in area and evaluate
+
+    if (environment != ENCOUNTER_TYPE_LAND && environment != ENCOUNTER_TYPE_WATER)
+        return FALSE;
+
+    if (!sDexNavTilesValid || sDexNavTilesMapGridVersion != GetMapGridVersion())
+        BuildDexNavEncounterTiles();
+
+    if (TestPlayerAvatarFlags(PLAYER_AVATAR_FLAG_BIKE))
+        tileBuffer = SNEAKING_PROXIMITY + 3;
+    else if (TestPlayerAvatarFlags(PLAYER_AVATAR_FLAG_DASH))
+        tileBuffer = SNEAKING_PROXIMITY + 1;
+
+    // loop through every encounter tile in area and evaluate
     while (topY < botY)
     {
-        while (topX < botX)
+        while ((topX = GetNextDexNavEncounterTile(environment, topX, botX, topY)) < botX)
         {
-            tileBehaviour = MapGridGetMetatileBehaviorAt(topX, topY);
-            
-            //gSpecialVar_0x8005 = tileBehaviour;
-            
-            //Check for objects
-            nextIter = FALSE;
-            if (TestPlayerAvatarFlags(PLAYER_AVATAR_FLAG_BIKE))
-                tileBuffer = SNEAKING_PROXIMITY + 3;
-            else if (TestPlayerAvatarFlags(PLAYER_AVATAR_FLAG_DASH))
-                tileBuffer = SNEAKING_PROXIMITY + 1;
-            
             if (GetPlayerDistance(topX, topY) <= tileBuffer)
             {
                 // tile too close to player
                 topX++;
                 continue;
             }
-            
-            for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
-            {
-                if (gObjectEvents[i].currentCoords.x == topX && gObjectEvents[i].currentCoords.y == topY)
-                {
-                    // cannot be on a tile where an object exists
-                    nextIter = TRUE;
-                    break;
-                }
-            }
-            
-            if (nextIter)
+
+            if (IsObjectEventAt(topX, topY))
             {
+                // cannot be on a tile where an object exists
                 topX++;
                 continue;
             }
-            
+
             switch (environment)
             {
             case ENCOUNTER_TYPE_LAND:
-                if (MetatileBehavior_IsLandWildEncounter(tileBehaviour))
-                {
-                    if (currMapType == MAP_TYPE_UNDERGROUND)
-                    { // inside (cave)
-                        if (IsZCoordMismatchAt(gObjectEvents[gPlayerAvatar.spriteId].currentElevation, topX, topY))
-                            break; //occurs at same z coord
-                        
-                        scale = 440 - (smallScan * 200) - (GetPlayerDistance(topX, topY) / 2)  - (2 * (topX + topY));
-                        weight = ((Random() % scale) < 1) && !MapGridIsImpassableAt(topX, topY);
-                    }
-                    else
-                    { // outdoors: grass
-                        scale = 100 - (GetPlayerDistance(topX, topY) * 2);
-                        weight = (Random() % scale <= 5) && !MapGridIsImpassableAt(topX, topY);
-                    }
+                if (currMapType == MAP_TYPE_UNDERGROUND)
+                { // inside (cave)
+                    if (IsZCoordMismatchAt(gObjectEvents[gPlayerAvatar.spriteId].currentElevation, topX, topY))
+                        break; //occurs at same z coord
+
+                    scale = 440 - (smallScan * 200) - (GetPlayerDistance(topX, topY) / 2)  - (2 * (topX + topY));
+                    weight = ((Random() % scale) < 1) && !MapGridIsImpassableAt(topX, topY);
+                }
+                else
+                { // outdoors: grass
+                    scale = 100 - (GetPlayerDistance(topX, topY) * 2);
+                    weight = (Random() % scale <= 5) && !MapGridIsImpassableAt(topX, topY);
                 }
                 break;
             case ENCOUNTER_TYPE_WATER:
-                if (MetatileBehavior_IsSurfableWaterOrUnderwater(tileBehaviour))
                 {
                     u8 scale = 320 - (smallScan * 200) - (GetPlayerDistance(topX, topY) / 2);
                     if (IsZCoordMismatchAt(gObjectEvents[gPlayerAvatar.spriteId].currentElevation, topX, topY))
@@ -712,20 +792,18 @@ static bool8 DexNavPickTile(u8 environment, u8 areaX, u8 areaY, bool8 smallScan)
                     weight = (Random() % scale <= 1) && !MapGridIsImpassableAt(topX, topY);
                 }
                 break;
-            default:
-                break;
             }
-            
+
             if (weight > 0)
             {
                 sDexNavSearchDataPtr->tileX = topX;
                 sDexNavSearchDataPtr->tileY = topY;
                 return TRUE;
             }
-            
+
             topX++;
         }
-        
+
         topY++;
         topX = gSaveBlock1Ptr->pos.x - SCANSTART_X + (smallScan * 5);
     }
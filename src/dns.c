@@ -332,6 +332,9 @@ const u16 gPaletteTagExceptions[] =
 //Functions
 static u16 DnsApplyFilterToColor(u16 color, u16 filter);
 static u16 DnsApplyProportionalFilterToColor(u16 color, u16 filter);
+static void DnsBuildFilterLuts(u16 filter);
+static u32 GetDnsActivePalettes(void);
+static bool8 DnsPaletteChanged(u8 palNum);
 static void DoDnsLightning();
 static u16 GetDNSFilter();
 static bool8 IsMapDNSException();
@@ -342,6 +345,19 @@ static bool8 IsLightActive();
 
 //Dns palette buffer in EWRAM
 ALIGNED(4) EWRAM_DATA static u16 sDnsPaletteDmaBuffer[512] = {0};
+//gPlttBufferFaded as it was the last time each palette was copied to the dma buffer
+ALIGNED(4) EWRAM_DATA static u16 sDnsPaletteSource[512] = {0};
+EWRAM_DATA static u32 sDnsDirtyPalettes = 0;
+EWRAM_DATA static u32 sDnsActivePalettes = 0;
+EWRAM_DATA static u16 sDnsLutFilter = 0;
+EWRAM_DATA static bool8 sDnsLutValid = FALSE;
+
+//Each channel of the current filter, already shifted into place
+static u16 sDnsRedLut[32];
+static u16 sDnsGreenLut[32];
+static u16 sDnsBlueLut[32];
+
+#define DNS_FILTER_COLOR(color) (sDnsRedLut[(color) & 0x1F] | sDnsGreenLut[((color) >> 5) & 0x1F] | sDnsBlueLut[((color) >> 10) & 0x1F])
 
 
 /* **************************************************** *
@@ -367,29 +383,120 @@ void DnsTransferPlttBuffer(void *src, void *dest)
 
 /* Applies filter to palette colors, stores new palettes in EWRAM buffer.   *
  * It must be called from CB2 if the DNS wants to be used (similar to        *
- * TransferPlttBuffer)  in VBlank callbacks                                  */
+ * TransferPlttBuffer)  in VBlank callbacks                                  *
+ * Only palettes that changed since the last call are filtered again; the    *
+ * whole buffer is rebuilt when the filter itself changes.                   */
 void DnsApplyFilters()
 {
     u8 palNum, colNum;
     u16 color, rgbFilter;
-    struct DnsPalExceptions palExceptionFlags;
+    u32 activePalettes, dirtyPalettes;
 
     rgbFilter = GetDNSFilter();
 
-    palExceptionFlags = gMain.inBattle ? gCombatPalExceptions : gOWPalExceptions;   //Init pal exception slots
+    dirtyPalettes = sDnsDirtyPalettes;
+    sDnsDirtyPalettes = 0;
+
+    if (!sDnsLutValid || rgbFilter != sDnsLutFilter)
+    {
+        DnsBuildFilterLuts(rgbFilter);
+        dirtyPalettes = 0xFFFFFFFF;
+    }
+
+    activePalettes = GetDnsActivePalettes();
+    dirtyPalettes |= activePalettes ^ sDnsActivePalettes;
+    sDnsActivePalettes = activePalettes;
 
     for (palNum = 0; palNum < 32; palNum++)
-        if (palExceptionFlags.pal[palNum] && (palNum < 15 || !IsSpritePaletteTagDnsException(palNum - 16)))
+    {
+        if (!(dirtyPalettes & (1 << palNum)) && !DnsPaletteChanged(palNum))
+            continue;
+
+        CpuCopy32(&gPlttBufferFaded[palNum * 16], &sDnsPaletteSource[palNum * 16], 32);
+        if (activePalettes & (1 << palNum))
+        {
             for (colNum = 0; colNum < 16; colNum++) //Transfer filtered palette to buffer
-                sDnsPaletteDmaBuffer[palNum * 16 + colNum] = DnsApplyProportionalFilterToColor(gPlttBufferFaded[palNum * 16 + colNum], rgbFilter);
+            {
+                color = sDnsPaletteSource[palNum * 16 + colNum];
+                sDnsPaletteDmaBuffer[palNum * 16 + colNum] = DNS_FILTER_COLOR(color);
+            }
+        }
         else
-            for (colNum = 0; colNum < 16; colNum++)  //Transfers palette to buffer without filtering
-                sDnsPaletteDmaBuffer[palNum * 16 + colNum] = gPlttBufferFaded[palNum * 16 + colNum];      
+        {
+            CpuCopy32(&sDnsPaletteSource[palNum * 16], &sDnsPaletteDmaBuffer[palNum * 16], 32); //Transfers palette to buffer without filtering
+        }
+    }
 
     if (!IsMapDNSException() && IsLightActive() && !gMain.inBattle)
         DoDnsLightning();
 }
 
+//Marks palettes that have been written to so they are filtered on the next DnsApplyFilters
+void DnsMarkPalettesDirty(u32 selectedPalettes)
+{
+    sDnsDirtyPalettes |= selectedPalettes;
+}
+
+//Same as above, for a range of colors. Size is in bytes, like LoadPalette.
+void DnsMarkPaletteRangeDirty(u16 offset, u16 size)
+{
+    u32 first, last;
+
+    if (size == 0 || offset >= 512)
+        return;
+
+    first = offset / 16;
+    last = (offset + size / 2 - 1) / 16;
+    if (last > 31)
+        last = 31;
+    sDnsDirtyPalettes |= ((2u << last) - 1) & ~((1u << first) - 1);
+}
+
+//Proportional filtering works on each channel independently, so a filter
+//is fully described by what it does to the 32 values of each channel.
+static void DnsBuildFilterLuts(u16 filter)
+{
+    u16 i;
+
+    for (i = 0; i < 32; i++)
+    {
+        sDnsRedLut[i] = DnsApplyProportionalFilterToColor(i, filter);
+        sDnsGreenLut[i] = DnsApplyProportionalFilterToColor(i << 5, filter);
+        sDnsBlueLut[i] = DnsApplyProportionalFilterToColor(i << 10, filter);
+    }
+    sDnsLutFilter = filter;
+    sDnsLutValid = TRUE;
+}
+
+//Returns a mask of the palettes that get filtered this frame
+static u32 GetDnsActivePalettes(void)
+{
+    u8 palNum;
+    u32 activePalettes = 0;
+    const struct DnsPalExceptions *palExceptionFlags;
+
+    palExceptionFlags = gMain.inBattle ? &gCombatPalExceptions : &gOWPalExceptions;   //Init pal exception slots
+
+    for (palNum = 0; palNum < 32; palNum++)
+        if (palExceptionFlags->pal[palNum] && (palNum < 15 || !IsSpritePaletteTagDnsException(palNum - 16)))
+            activePalettes |= 1 << palNum;
+
+    return activePalettes;
+}
+
+//Catches writes to gPlttBufferFaded that didn't go through the palette functions
+static bool8 DnsPaletteChanged(u8 palNum)
+{
+    u8 i;
+    const u32 *src = (const u32 *)&gPlttBufferFaded[palNum * 16];
+    const u32 *last = (const u32 *)&sDnsPaletteSource[palNum * 16];
+
+    for (i = 0; i < 8; i++)
+        if (src[i] != last[i])
+            return TRUE;
+    return FALSE;
+}
+
 //Applies filter to a color. Filters RGB channels are substracted from color RGB channels.
 //Based on Andrea's DNS filtering system 
 static u16 DnsApplyFilterToColor(u16 color, u16 filter)
@@ -1,4 +1,5 @@
 #include "global.h"
+#include "bitset.h"
 #include "event_data.h"
 #include "pokedex.h"
 
@@ -9,7 +10,6 @@
 
 #define SPECIAL_FLAGS_SIZE  (NUM_SPECIAL_FLAGS / 8)  // 8 flags per byte
 #define TEMP_FLAGS_SIZE     (NUM_TEMP_FLAGS / 8)
-#define DAILY_FLAGS_SIZE    (NUM_DAILY_FLAGS / 8)
 #define TEMP_VARS_SIZE      (NUM_TEMP_VARS * 2)      // 1/2 var per byte
 
 EWRAM_DATA u16 gSpecialVar_0x8000 = 0;
@@ -57,7 +57,7 @@ void ClearTempFieldEventData(void)
 
 void ClearDailyFlags(void)
 {
-    memset(gSaveBlock1Ptr->flags + (DAILY_FLAGS_START / 8), 0, DAILY_FLAGS_SIZE);
+    FlagClearRange(DAILY_FLAGS_START, NUM_DAILY_FLAGS);
 }
 
 void DisableMysteryEvent(void)
@@ -207,3 +207,58 @@ bool8 FlagGet(u16 id)
 
     return TRUE;
 }
+
+// The range functions take a run of flag IDs, which must not cross from the
+// save's flags into the special flags.
+static u8 *GetFlagRangeBase(u16 *first)
+{
+    if (*first < SPECIAL_FLAGS_START)
+        return gSaveBlock1Ptr->flags;
+
+    *first -= SPECIAL_FLAGS_START;
+    return gSpecialFlags;
+}
+
+u32 FlagCountRange(u16 first, u16 count)
+{
+    u8 *flags = GetFlagRangeBase(&first);
+
+    return BitsetCount(flags, first, count);
+}
+
+// Returns the ID of the first flag in the range that is set, or 0 if none.
+u16 FlagFindFirstSet(u16 first, u16 count)
+{
+    u16 base = first;
+    u8 *flags = GetFlagRangeBase(&first);
+    s32 bit = BitsetFindFirstSet(flags, first, count);
+
+    if (bit < 0)
+        return 0;
+    return base + (bit - first);
+}
+
+u16 FlagFindFirstClear(u16 first, u16 count)
+{
+    u16 base = first;
+    u8 *flags = GetFlagRangeBase(&first);
+    s32 bit = BitsetFindFirstClear(flags, first, count);
+
+    if (bit < 0)
+        return 0;
+    return base + (bit - first);
+}
+
+void FlagSetRange(u16 first, u16 count)
+{
+    u8 *flags = GetFlagRangeBase(&first);
+
+    BitsetSetRange(flags, first, count);
+}
+
+void FlagClearRange(u16 first, u16 count)
+{
+    u8 *flags = GetFlagRangeBase(&first);
+
+    BitsetClearRange(flags, first, count);
+}
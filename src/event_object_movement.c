@@ -60,6 +60,18 @@ static u8 setup##_callback(struct ObjectEvent *objectEvent, struct Sprite *sprit
 EWRAM_DATA struct LockedAnimObjectEvents *gLockedAnimObjectEvents = {0};
 EWRAM_DATA const u8 *gFollowerScript = NULL;
 
+// Active object events filed by tile in a small grid that wraps around the
+// map, so "who is standing here" doesn't need to walk gObjectEvents. Each
+// cell is a mask of object event ids; tiles OCCUPANCY_GRID_SIZE apart share
+// a cell, so callers still compare coords. Objects are filed under both
+// their current and previous coords, since a moving object blocks both.
+#define OCCUPANCY_GRID_SIZE 8
+#define OCCUPANCY_CELL(x, y) ((((y) & (OCCUPANCY_GRID_SIZE - 1)) * OCCUPANCY_GRID_SIZE) + ((x) & (OCCUPANCY_GRID_SIZE - 1)))
+
+static u16 sObjectEventOccupancy[OCCUPANCY_GRID_SIZE * OCCUPANCY_GRID_SIZE];
+static u8 sObjectEventOccupancyCells[OBJECT_EVENTS_COUNT][2];
+static u16 sObjectEventsInOccupancy;
+
 static void MoveCoordsInDirection(u32, s16 *, s16 *, s16, s16);
 static bool8 ObjectEventExecSingleMovementAction(struct ObjectEvent *, struct Sprite *);
 static void SetMovementDelay(struct Sprite *, s16);
@@ -962,6 +974,71 @@ static void ClearAllObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         ClearObjectEvent(&gObjectEvents[i]);
+    RebuildObjectEventOccupancy();
+}
+
+// Must be called after anything changes an object event's coords or
+// whether it is active.
+void UpdateObjectEventOccupancy(struct ObjectEvent *objectEvent)
+{
+    u8 objectEventId;
+    u16 bit;
+
+    if (objectEvent < gObjectEvents || objectEvent >= &gObjectEvents[OBJECT_EVENTS_COUNT])
+        return;
+
+    objectEventId = objectEvent - gObjectEvents;
+    bit = 1 << objectEventId;
+    if (sObjectEventsInOccupancy & bit)
+    {
+        sObjectEventOccupancy[sObjectEventOccupancyCells[objectEventId][0]] &= ~bit;
+        sObjectEventOccupancy[sObjectEventOccupancyCells[objectEventId][1]] &= ~bit;
+        sObjectEventsInOccupancy &= ~bit;
+    }
+
+    if (objectEvent->active)
+    {
+        sObjectEventOccupancyCells[objectEventId][0] = OCCUPANCY_CELL(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+        sObjectEventOccupancyCells[objectEventId][1] = OCCUPANCY_CELL(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+        sObjectEventOccupancy[sObjectEventOccupancyCells[objectEventId][0]] |= bit;
+        sObjectEventOccupancy[sObjectEventOccupancyCells[objectEventId][1]] |= bit;
+        sObjectEventsInOccupancy |= bit;
+    }
+}
+
+void RebuildObjectEventOccupancy(void)
+{
+    u8 i;
+
+    for (i = 0; i < OCCUPANCY_GRID_SIZE * OCCUPANCY_GRID_SIZE; i++)
+        sObjectEventOccupancy[i] = 0;
+    sObjectEventsInOccupancy = 0;
+
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventOccupancy(&gObjectEvents[i]);
+}
+
+// Returns a mask of the active object events that may be standing on or
+// stepping off the given tile. Check their coords before relying on it.
+u16 GetObjectEventOccupancyAt(s16 x, s16 y)
+{
+    return sObjectEventOccupancy[OCCUPANCY_CELL(x, y)];
+}
+
+// Whether an active object event is standing on or stepping off the tile.
+bool8 IsObjectEventAt(s16 x, s16 y)
+{
+    u8 i;
+    u16 objectEvents = GetObjectEventOccupancyAt(x, y);
+
+    for (i = 0; objectEvents != 0; i++, objectEvents >>= 1)
+    {
+        if ((objectEvents & 1)
+         && ((gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+          || (gObjectEvents[i].previousCoords.x == x && gObjectEvents[i].previousCoords.y == y)))
+            return TRUE;
+    }
+    return FALSE;
 }
 
 void ResetObjectEvents(void)
@@ -1020,13 +1097,15 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
     u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u16 objectEvents = GetObjectEventOccupancyAt(x, y);
+
+    for (i = 0; objectEvents != 0; i++, objectEvents >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((objectEvents & 1) && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
@@ -1083,6 +1162,7 @@ static u8 InitObjectEventStateFromTemplate(struct ObjectEventTemplate *template,
     objectEvent->previousElevation = template->elevation;
     objectEvent->range.as_nybbles.x = template->movementRangeX;
     objectEvent->range.as_nybbles.y = template->movementRangeY;
+    UpdateObjectEventOccupancy(objectEvent);
     objectEvent->trainerType = template->trainerType;
     objectEvent->mapNum = mapNum;
     objectEvent->trainerRange_berryTreeId = template->trainerRange_berryTreeId;
@@ -1166,6 +1246,7 @@ static bool8 GetAvailableObjectEventId(u16 localId, u8 mapNum, u8 mapGroup, u8 *
 static void RemoveObjectEvent(struct ObjectEvent *objectEvent)
 {
     objectEvent->active = FALSE;
+    UpdateObjectEventOccupancy(objectEvent);
     RemoveObjectEventInternal(objectEvent);
 }
 
@@ -1229,6 +1310,7 @@ static u8 TrySetupObjectEventSprite(struct ObjectEventTemplate *objectEventTempl
     if (spriteId == MAX_SPRITES)
     {
         gObjectEvents[objectEventId].active = FALSE;
+        UpdateObjectEventOccupancy(&gObjectEvents[objectEventId]);
         return OBJECT_EVENTS_COUNT;
     }
 
@@ -2005,6 +2087,7 @@ void unref_sub_808EAC4(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2013,6 +2096,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2021,6 +2105,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventOccupancy(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -2079,16 +2164,18 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventOccupancy();
     }
 }
 
 u8 GetObjectEventIdByXYZ(u16 x, u16 y, u8 z)
 {
     u8 i;
+    u16 objectEvents = GetObjectEventOccupancyAt(x, y);
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; objectEvents != 0; i++, objectEvents >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if (objectEvents & 1)
         {
             if (gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y && ObjectEventDoesZCoordMatch(&gObjectEvents[i], z))
             {
@@ -4975,12 +5062,13 @@ static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *objectEvent,
 static bool8 DoesObjectCollideWithObjectAt(struct ObjectEvent *objectEvent, s16 x, s16 y)
 {
     u8 i;
+    u16 objectEvents = GetObjectEventOccupancyAt(x, y);
     struct ObjectEvent *curObject;
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; objectEvents != 0; i++, objectEvents >>= 1)
     {
         curObject = &gObjectEvents[i];
-        if (curObject->active && curObject != objectEvent)
+        if ((objectEvents & 1) && curObject != objectEvent)
         {
             if ((curObject->currentCoords.x == x && curObject->currentCoords.y == y) || (curObject->previousCoords.x == x && curObject->previousCoords.y == y))
             {
@@ -3878,3 +3878,15 @@ u8 Script_TryGainNewFanFromCounter(void)
 {
     return TryGainNewFanFromCounter(gSpecialVar_0x8004);
 }
+
+// Debug report on the heap. Buffers the largest free block, the number of
+// blocks and the high-water mark (all in bytes except the block count).
+void BufferHeapReport(void)
+{
+    struct HeapStats stats;
+
+    GetHeapStats(&stats);
+    ConvertIntToDecimalStringN(gStringVar1, stats.largestFreeBlock, STR_CONV_MODE_LEFT_ALIGN, 6);
+    ConvertIntToDecimalStringN(gStringVar2, stats.usedBlocks + stats.freeBlocks, STR_CONV_MODE_LEFT_ALIGN, 4);
+    ConvertIntToDecimalStringN(gStringVar3, stats.highWaterMark, STR_CONV_MODE_LEFT_ALIGN, 6);
+}
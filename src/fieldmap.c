@@ -31,6 +31,14 @@ EWRAM_DATA struct MapHeader gMapHeader = {0};
 EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags gMapConnectionFlags = {0};
 EWRAM_DATA static u32 sFiller_02037344 = 0; // without this, the next file won't align properly
+// Bumped whenever the backup map layout is rebuilt or a metatile in it
+// changes, so data derived from the map grid knows when to refresh.
+EWRAM_DATA static u32 sMapGridVersion = 0;
+// Behavior byte of every tile in the backup map layout, so behavior lookups
+// don't have to go through the tileset attribute tables. Collision and
+// elevation already live in the map grid entry itself.
+EWRAM_DATA static u8 sMetatileBehaviors[MAX_MAP_DATA_SIZE] = {0};
+EWRAM_DATA static bool8 sMetatileBehaviorsValid = FALSE;
 
 struct BackupMapLayout gBackupMapLayout;
 
@@ -45,6 +53,8 @@ static void FillEastConnection(struct MapHeader const *mapHeader, struct MapHead
 static void InitBackupMapLayoutConnections(struct MapHeader *mapHeader);
 static void LoadSavedMapView(void);
 static bool8 SkipCopyingMetatileFromSavedMap(u16* mapMetatilePtr, u16 mapWidth, u8 yMode);
+static void BuildMetatileBehaviorCache(void);
+static void UpdateMetatileBehaviorCacheAt(int x, int y);
 
 struct MapHeader const *const GetMapHeaderFromConnection(struct MapConnection *connection)
 {
@@ -72,12 +82,16 @@ void InitBattlePyramidMap(bool8 setPlayerPosition)
 {
     CpuFastFill(0x03ff03ff, gBackupMapData, sizeof(gBackupMapData));
     GenerateBattlePyramidFloorLayout(gBackupMapData, setPlayerPosition);
+    BuildMetatileBehaviorCache();
+    sMapGridVersion++;
 }
 
 void InitTrainerHillMap(void)
 {
     CpuFastFill(0x03ff03ff, gBackupMapData, sizeof(gBackupMapData));
     GenerateTrainerHillFloorLayout(gBackupMapData);
+    BuildMetatileBehaviorCache();
+    sMapGridVersion++;
 }
 
 static void InitMapLayoutData(struct MapHeader *mapHeader)
@@ -97,6 +111,8 @@ static void InitMapLayoutData(struct MapHeader *mapHeader)
         InitBackupMapLayoutData(mapLayout->map, mapLayout->width, mapLayout->height);
         InitBackupMapLayoutConnections(mapHeader);
     }
+    BuildMetatileBehaviorCache();
+    sMapGridVersion++;
 }
 
 static void InitBackupMapLayoutData(u16 *map, u16 width, u16 height)
@@ -459,10 +475,42 @@ u32 MapGridGetMetatileIdAt(int x, int y)
 u32 MapGridGetMetatileBehaviorAt(int x, int y)
 {
     u16 metatile;
+
+    if (sMetatileBehaviorsValid
+     && x >= 0 && x < gBackupMapLayout.width
+     && y >= 0 && y < gBackupMapLayout.height)
+        return sMetatileBehaviors[x + gBackupMapLayout.width * y];
+
     metatile = MapGridGetMetatileIdAt(x, y);
     return GetBehaviorByMetatileId(metatile) & 0xff;
 }
 
+static void UpdateMetatileBehaviorCacheAt(int x, int y)
+{
+    if (sMetatileBehaviorsValid
+     && x >= 0 && x < gBackupMapLayout.width
+     && y >= 0 && y < gBackupMapLayout.height)
+        sMetatileBehaviors[x + gBackupMapLayout.width * y] = GetBehaviorByMetatileId(MapGridGetMetatileIdAt(x, y)) & 0xff;
+}
+
+static void BuildMetatileBehaviorCache(void)
+{
+    int x, y;
+    u8 *behavior;
+
+    sMetatileBehaviorsValid = FALSE;
+    if (gBackupMapLayout.width * gBackupMapLayout.height > MAX_MAP_DATA_SIZE)
+        return;
+
+    behavior = sMetatileBehaviors;
+    for (y = 0; y < gBackupMapLayout.height; y++)
+    {
+        for (x = 0; x < gBackupMapLayout.width; x++)
+            *behavior++ = GetBehaviorByMetatileId(MapGridGetMetatileIdAt(x, y)) & 0xff;
+    }
+    sMetatileBehaviorsValid = TRUE;
+}
+
 u8 MapGridGetMetatileLayerTypeAt(int x, int y)
 {
     u16 metatile;
@@ -478,6 +526,8 @@ void MapGridSetMetatileIdAt(int x, int y, u16 metatile)
     {
         i = x + y * gBackupMapLayout.width;
         gBackupMapLayout.map[i] = (gBackupMapLayout.map[i] & METATILE_ELEVATION_MASK) | (metatile & ~METATILE_ELEVATION_MASK);
+        UpdateMetatileBehaviorCacheAt(x, y);
+        sMapGridVersion++;
     }
 }
 
@@ -489,9 +539,16 @@ void MapGridSetMetatileEntryAt(int x, int y, u16 metatile)
     {
         i = x + gBackupMapLayout.width * y;
         gBackupMapLayout.map[i] = metatile;
+        UpdateMetatileBehaviorCacheAt(x, y);
+        sMapGridVersion++;
     }
 }
 
+u32 GetMapGridVersion(void)
+{
+    return sMapGridVersion;
+}
+
 u16 GetBehaviorByMetatileId(u16 metatile)
 {
     u16 *attributes;
@@ -582,7 +639,10 @@ static void LoadSavedMapView(void)
             for (j = x; j < x + 15; j++)
             {
                 if (!SkipCopyingMetatileFromSavedMap(&gBackupMapData[j + width * i], width, yMode))
+                {
                     gBackupMapData[j + width * i] = *mapView;
+                    UpdateMetatileBehaviorCacheAt(j, i);
+                }
                 mapView++;
             }
         }
@@ -594,6 +654,7 @@ static void LoadSavedMapView(void)
                 FixLongGrassMetatilesWindowBottom(j, y + 13);
         }
         ClearSavedMapView();
+        sMapGridVersion++;
     }
 }
 
@@ -646,11 +707,13 @@ void sub_80885C4(u8 a1)
             src = &mapView[srci + i];
             dest = &gBackupMapData[x0 + desti + j];
             *dest = *src;
+            UpdateMetatileBehaviorCacheAt(x0 + j, y + y0);
             i++;
             j++;
         }
     }
     ClearSavedMapView();
+    sMapGridVersion++;
 }
 
 int GetMapBorderIdAt(int x, int y)
@@ -950,6 +1013,7 @@ void MapGridSetMetatileImpassabilityAt(int x, int y, bool32 impassable)
             gBackupMapLayout.map[x + gBackupMapLayout.width * y] |= METATILE_COLLISION_MASK;
         else
             gBackupMapLayout.map[x + gBackupMapLayout.width * y] &= ~METATILE_COLLISION_MASK;
+        sMapGridVersion++;
     }
 }
 
@@ -0,0 +1,206 @@
+#include "global.h"
+#include "frame_budget.h"
+#include "main.h"
+#include "menu.h"
+#include "overworld.h"
+#include "string_util.h"
+#include "text.h"
+#include "window.h"
+
+#if FRAME_BUDGET_ENABLED
+
+#define NUM_BUDGET_STATS        8  // callbacks tracked at once
+#define BUDGET_MAX_FRAMES       64 // frames per rolling max window
+#define OVERLAY_REFRESH_FRAMES  16
+
+// Field windows on BG 0 use tiles up to 0x278 (the match call window and its
+// border), and BG 0's tilemaps start at 0x300, so the overlay goes between.
+// On screen it sits left of the start menu, yes/no and list menus, below the
+// map name, money and notification boxes and above the message box.
+#define OVERLAY_LEFT            1
+#define OVERLAY_TOP             5
+#define OVERLAY_WIDTH           15
+#define OVERLAY_HEIGHT          6
+#define OVERLAY_BASE_BLOCK      0x280
+
+struct FrameBudgetStats
+{
+    MainCallback callback;
+    u32 lastFrame;
+    u16 frames; // in the current max window
+    u16 drops;
+    u32 avg[FRAME_BUDGET_SECTION_COUNT]; // exponential average over ~16 frames, scaled by 16
+    u16 max[FRAME_BUDGET_SECTION_COUNT];
+    u16 prevMax[FRAME_BUDGET_SECTION_COUNT];
+};
+
+EWRAM_DATA static struct FrameBudgetStats sFrameBudgetStats[NUM_BUDGET_STATS] = {0};
+EWRAM_DATA static struct FrameBudgetStats *sLastFrameStats = NULL;
+EWRAM_DATA static MainCallback sFrameCallback = NULL;
+EWRAM_DATA static u32 sFrameVBlankCounter = 0;
+EWRAM_DATA static u32 sSectionStart[FRAME_BUDGET_SECTION_COUNT] = {0};
+EWRAM_DATA static u32 sSectionTime[FRAME_BUDGET_SECTION_COUNT] = {0};
+EWRAM_DATA static bool8 sOverlayEnabled = FALSE;
+EWRAM_DATA static u8 sOverlayWindowId = 0xFF;
+EWRAM_DATA static u8 sOverlayTimer = 0;
+
+static const u8 sText_Callback[] = _("CB2 ");
+static const u8 sText_Drops[] = _("{CLEAR_TO 60}DROPS ");
+static const u8 sText_Busy[] = _("\nBUSY ");
+static const u8 sText_Max[] = _("{CLEAR_TO 60}MAX ");
+static const u8 sText_Tasks[] = _("\nTASKS ");
+static const u8 sText_Sprites[] = _("{CLEAR_TO 60}SPR ");
+static const u8 sText_Oam[] = _("\nOAM ");
+static const u8 sText_VBlank[] = _("{CLEAR_TO 60}VBL ");
+static const u8 sText_Percent[] = _("%");
+
+void FrameBudgetBeginSection(u8 section)
+{
+    sSectionStart[section] = GetTraceTimestamp();
+}
+
+// Sections run more than once a frame add up.
+void FrameBudgetEndSection(u8 section)
+{
+    sSectionTime[section] += GetTraceTimestamp() - sSectionStart[section];
+}
+
+void FrameBudgetBeginFrame(void)
+{
+    // The wait after the last frame took more than one VBlank.
+    if (sLastFrameStats != NULL && gMain.vblankCounter1 - sFrameVBlankCounter > 1)
+        sLastFrameStats->drops++;
+
+    sFrameVBlankCounter = gMain.vblankCounter1;
+    sFrameCallback = gMain.callback2;
+    FrameBudgetBeginSection(FRAME_BUDGET_BUSY);
+}
+
+static struct FrameBudgetStats *GetFrameBudgetStats(MainCallback callback)
+{
+    struct FrameBudgetStats *oldest = &sFrameBudgetStats[0];
+    u32 i;
+
+    for (i = 0; i < NUM_BUDGET_STATS; i++)
+    {
+        if (sFrameBudgetStats[i].callback == callback)
+            return &sFrameBudgetStats[i];
+        if (sFrameBudgetStats[i].lastFrame < oldest->lastFrame)
+            oldest = &sFrameBudgetStats[i];
+    }
+
+    memset(oldest, 0, sizeof(*oldest));
+    oldest->callback = callback;
+    return oldest;
+}
+
+static u8 *AppendPercent(u8 *dest, const u8 *label, u32 ticks)
+{
+    dest = StringCopy(dest, label);
+    dest = ConvertIntToDecimalStringN(dest, ticks * 100 / FRAME_BUDGET_TICKS, STR_CONV_MODE_RIGHT_ALIGN, 3);
+    return StringCopy(dest, sText_Percent);
+}
+
+static u32 GetRollingMax(struct FrameBudgetStats *stats, u8 section)
+{
+    return max(stats->max[section], stats->prevMax[section]);
+}
+
+static void DrawFrameBudgetOverlay(struct FrameBudgetStats *stats)
+{
+    u8 *str = gStringVar4;
+
+    str = StringCopy(str, sText_Callback);
+    str = ConvertIntToHexStringN(str, (u32)stats->callback, STR_CONV_MODE_LEADING_ZEROS, 7);
+    str = StringCopy(str, sText_Drops);
+    str = ConvertIntToDecimalStringN(str, stats->drops, STR_CONV_MODE_LEFT_ALIGN, 5);
+    str = AppendPercent(str, sText_Busy, stats->avg[FRAME_BUDGET_BUSY] >> 4);
+    str = AppendPercent(str, sText_Max, GetRollingMax(stats, FRAME_BUDGET_BUSY));
+    str = AppendPercent(str, sText_Tasks, stats->avg[FRAME_BUDGET_TASKS] >> 4);
+    str = AppendPercent(str, sText_Sprites, stats->avg[FRAME_BUDGET_SPRITES] >> 4);
+    str = AppendPercent(str, sText_Oam, stats->avg[FRAME_BUDGET_OAM] >> 4);
+    str = AppendPercent(str, sText_VBlank, stats->avg[FRAME_BUDGET_VBLANK] >> 4);
+
+    FillWindowPixelBuffer(sOverlayWindowId, PIXEL_FILL(0));
+    AddTextPrinterParameterized(sOverlayWindowId, 0, gStringVar4, 0, 0, 0xFF, NULL);
+    CopyWindowToVram(sOverlayWindowId, 3);
+}
+
+// The overlay uses a window on BG 0, so it is only shown in the field. When
+// the game leaves the field the window goes with the rest of that screen's
+// windows, and a new one is made on the way back.
+static void UpdateFrameBudgetOverlay(struct FrameBudgetStats *stats)
+{
+    bool32 inField = (gMain.callback2 == CB2_Overworld);
+
+    if (JOY_NEW(B_BUTTON) && JOY_HELD_RAW(L_BUTTON) && JOY_HELD_RAW(R_BUTTON))
+    {
+        sOverlayEnabled ^= TRUE;
+        if (!sOverlayEnabled && inField && sOverlayWindowId != 0xFF)
+        {
+            ClearWindowTilemap(sOverlayWindowId);
+            RemoveWindow(sOverlayWindowId);
+            ScheduleBgCopyTilemapToVram(0);
+        }
+        if (!sOverlayEnabled)
+            sOverlayWindowId = 0xFF;
+    }
+
+    if (!inField)
+        sOverlayWindowId = 0xFF;
+    if (!sOverlayEnabled || !inField || stats->callback != CB2_Overworld)
+        return;
+
+    if (sOverlayWindowId == 0xFF)
+    {
+        struct WindowTemplate template;
+
+        SetWindowTemplateFields(&template, 0, OVERLAY_LEFT, OVERLAY_TOP, OVERLAY_WIDTH, OVERLAY_HEIGHT, 15, OVERLAY_BASE_BLOCK);
+        sOverlayWindowId = AddWindow(&template);
+        if (sOverlayWindowId == 0xFF)
+            return;
+        PutWindowTilemap(sOverlayWindowId);
+        sOverlayTimer = OVERLAY_REFRESH_FRAMES;
+    }
+
+    if (++sOverlayTimer >= OVERLAY_REFRESH_FRAMES)
+    {
+        sOverlayTimer = 0;
+        DrawFrameBudgetOverlay(stats);
+    }
+}
+
+void FrameBudgetEndFrame(void)
+{
+    struct FrameBudgetStats *stats;
+    u32 traceArg;
+    u32 i;
+
+    FrameBudgetEndSection(FRAME_BUDGET_BUSY);
+    traceArg = (min(sSectionTime[FRAME_BUDGET_VBLANK], 0xFFFF) << 16) | min(sSectionTime[FRAME_BUDGET_BUSY], 0xFFFF);
+
+    stats = GetFrameBudgetStats(sFrameCallback);
+    stats->lastFrame = sFrameVBlankCounter;
+    for (i = 0; i < FRAME_BUDGET_SECTION_COUNT; i++)
+    {
+        u16 time = min(sSectionTime[i], 0xFFFF);
+
+        stats->avg[i] += time - (stats->avg[i] >> 4);
+        if (time > stats->max[i])
+            stats->max[i] = time;
+        sSectionTime[i] = 0;
+    }
+
+    if (++stats->frames >= BUDGET_MAX_FRAMES)
+    {
+        memcpy(stats->prevMax, stats->max, sizeof(stats->max));
+        memset(stats->max, 0, sizeof(stats->max));
+        stats->frames = 0;
+    }
+
+    TRACE_INSTANT2(TRACE_FRAME_BUDGET, stats->callback, traceArg);
+    sLastFrameStats = stats;
+    UpdateFrameBudgetOverlay(stats);
+}
+
+#endif // FRAME_BUDGET_ENABLED
@@ -27,6 +27,7 @@
 #include "constants/rgb.h"
 #include "constants/battle_anim.h"
 #include "rtc.h"
+#include "text.h"
 
 /*
  * Intro animation sequence state machine
@@ -1121,6 +1122,7 @@ void CB2_InitCopyrightScreenAfterBootup(void)
             Sav2_ClearSetDefault();
         SetPokemonCryStereo();
         InitHeap(gHeap, HEAP_SIZE);
+        InitGlyphCache();
         #ifdef RYU_PUNISH_SAVE_STATE
         gSaveBlock2Ptr->RtcTimeSecondRAW = RtcGetSecondCountRAW();
         gSaveBlock2Ptr->RtcTimeSecond = RtcGetSecondCount();
@@ -1637,6 +1637,7 @@ void CB2_LinkError(void)
     m4aMPlayStop(&gMPlayInfo_SE2);
     m4aMPlayStop(&gMPlayInfo_SE3);
     InitHeap(gHeap, HEAP_SIZE);
+    InitGlyphCache();
     ResetSpriteData();
     FreeAllSpritePalettes();
     ResetPaletteFadeControl();
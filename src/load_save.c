@@ -12,6 +12,8 @@
 #include "gba/flash_internal.h"
 #include "decoration_inventory.h"
 #include "agb_flash.h"
+#include "event_object_movement.h"
+#include "text.h"
 
 static void ApplyNewEncryptionKeyToAllEncryptedData(u32 encryptionKey);
 
@@ -178,6 +180,7 @@ void MoveSaveBlocks_ResetHeap(void)
 
     // heap was destroyed in the copying process, so reset it
     InitHeap(gHeap, HEAP_SIZE);
+    InitGlyphCache();
 
     // restore interrupt functions
     gMain.hblankCallback = hblankCB;
@@ -249,6 +252,7 @@ void LoadObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         gObjectEvents[i] = gSaveBlock1Ptr->objectEvents[i];
+    RebuildObjectEventOccupancy();
 }
 
 void SaveSerializedGame(void)
@@ -0,0 +1,79 @@
+#include "global.h"
+#include "lz_decoder.h"
+
+void LZDecoderInit(struct LZDecoder *decoder, const u32 *src, void *dest)
+{
+    const u8 *header = (const u8 *)src;
+
+    decoder->src = header + 4;
+    decoder->dest = dest;
+    decoder->size = header[1] | (header[2] << 8) | (header[3] << 16);
+    decoder->pos = 0;
+    decoder->copyDist = 0;
+    decoder->copyLeft = 0;
+    decoder->flags = 0;
+    decoder->flagsLeft = 0;
+    decoder->pendingByte = 0;
+}
+
+static void WriteByte(struct LZDecoder *decoder, u8 value)
+{
+    if (decoder->pos & 1)
+        *(u16 *)(decoder->dest + decoder->pos - 1) = decoder->pendingByte | (value << 8);
+    else
+        decoder->pendingByte = value;
+    decoder->pos++;
+}
+
+static u8 ReadOutputByte(struct LZDecoder *decoder, u32 pos)
+{
+    // Back-references can reach the even byte that isn't written out yet.
+    if ((decoder->pos & 1) && pos == decoder->pos - 1)
+        return decoder->pendingByte;
+    return decoder->dest[pos];
+}
+
+bool8 LZDecoderRun(struct LZDecoder *decoder, u32 maxBytes)
+{
+    u32 end = decoder->pos + maxBytes;
+
+    if (end > decoder->size || end < decoder->pos)
+        end = decoder->size;
+
+    while (decoder->pos < end)
+    {
+        if (decoder->copyLeft != 0)
+        {
+            WriteByte(decoder, ReadOutputByte(decoder, decoder->pos - decoder->copyDist));
+            decoder->copyLeft--;
+            continue;
+        }
+
+        if (decoder->flagsLeft == 0)
+        {
+            decoder->flags = *decoder->src++;
+            decoder->flagsLeft = 8;
+        }
+
+        if (decoder->flags & 0x80)
+        {
+            decoder->copyLeft = (decoder->src[0] >> 4) + 3;
+            decoder->copyDist = (((decoder->src[0] & 0xF) << 8) | decoder->src[1]) + 1;
+            decoder->src += 2;
+        }
+        else
+        {
+            WriteByte(decoder, *decoder->src++);
+        }
+        decoder->flags <<= 1;
+        decoder->flagsLeft--;
+    }
+
+    if (decoder->pos < decoder->size)
+        return FALSE;
+
+    // The last byte of an odd size goes out with the byte after it unchanged.
+    if (decoder->size & 1)
+        *(u16 *)(decoder->dest + decoder->size - 1) = decoder->pendingByte | (decoder->dest[decoder->size] << 8);
+    return TRUE;
+}
@@ -26,6 +26,8 @@
 #include "event_data.h"
 #include "pokemon_storage_system.h"
 #include "overworld_notif.h"
+#include "frame_budget.h"
+#include "trace.h"
 
 static void VBlankIntr(void);
 static void HBlankIntr(void);
@@ -105,6 +107,7 @@ void AgbMain()
     REG_WAITCNT = WAITCNT_PREFETCH_ENABLE | WAITCNT_WS0_S_1 | WAITCNT_WS0_N_3;
     InitKeys();
     InitIntrHandlers();
+    TraceInit();
     m4aSoundInit();
     EnableVCountIntrAtLine150();
     InitRFU();
@@ -117,6 +120,7 @@ void AgbMain()
     ResetBgs();
     SetDefaultFontsPointer();
     InitHeap(gHeap, HEAP_SIZE);
+    InitGlyphCache();
 
     gSoftResetDisabled = FALSE;
 
@@ -132,6 +136,8 @@ void AgbMain()
 
     for (i = 0; ; ++i)
     {
+        FrameBudgetBeginFrame();
+        TRACE_BEGIN(TRACE_FRAME);
         ReadKeys();
         #ifdef RYU_PUNISH_SAVE_STATE
         if (!(i % 5))
@@ -170,6 +176,16 @@ void AgbMain()
 
         PlayTimeCounter_Update();
         MapMusicMain(); 
+        TRACE_END(TRACE_FRAME);
+        FrameBudgetEndFrame();
+
+    #if TRACE_ENABLED
+        if (JOY_NEW(SELECT_BUTTON) && (gMain.heldKeysRaw & (L_BUTTON | R_BUTTON)) == (L_BUTTON | R_BUTTON))
+            DumpTraceBuffer();
+        if (JOY_NEW(START_BUTTON) && (gMain.heldKeysRaw & (L_BUTTON | R_BUTTON)) == (L_BUTTON | R_BUTTON))
+            DumpSpriteTileMap();
+    #endif
+
         WaitForVBlank();
     }
 }
@@ -194,10 +210,20 @@ static void InitMainCallbacks(void)
 static void CallCallbacks(void)
 {
     if (gMain.callback1)
+    {
+        TRACE_BEGIN(TRACE_CALLBACK1);
         gMain.callback1();
+        TRACE_END(TRACE_CALLBACK1);
+    }
 
     if (gMain.callback2)
+    {
+        TRACE_BEGIN(TRACE_CALLBACK2);
+        FRAME_BUDGET_BEGIN(FRAME_BUDGET_CALLBACK2);
         gMain.callback2();
+        FRAME_BUDGET_END(FRAME_BUDGET_CALLBACK2);
+        TRACE_END(TRACE_CALLBACK2);
+    }
 }
 
 void SetMainCallback2(MainCallback callback)
@@ -206,16 +232,21 @@ void SetMainCallback2(MainCallback callback)
     gMain.state = 0;
 }
 
+// With tracing on, Timer1 is already running as the trace clock.
 void StartTimer1(void)
 {
+#if !TRACE_CLOCK_ENABLED
     REG_TM1CNT_H = 0x80;
+#endif
 }
 
 void SeedRngAndSetTrainerId(void)
 {
     u16 val = REG_TM1CNT_L;
     SeedRng(val);
+#if !TRACE_CLOCK_ENABLED
     REG_TM1CNT_H = 0;
+#endif
     gTrainerId = val;
 }
 
@@ -333,6 +364,7 @@ void SetSerialCallback(IntrCallback callback)
 
 static void VBlankIntr(void)
 {
+    FRAME_BUDGET_BEGIN(FRAME_BUDGET_VBLANK);
     if (gWirelessCommType != 0)
         RfuVSync();
     else if (gLinkVSyncDisabled == FALSE)
@@ -363,6 +395,7 @@ static void VBlankIntr(void)
 
     INTR_CHECK |= INTR_FLAG_VBLANK;
     gMain.intrCheck |= INTR_FLAG_VBLANK;
+    FRAME_BUDGET_END(FRAME_BUDGET_VBLANK);
 }
 
 void InitFlashTimer(void)
@@ -78,6 +78,7 @@
 #include "RyuRealEstate.h"
 #include "overworld_notif.h"
 #include "ryu_challenge_modifiers.h"
+#include "trace.h"
 
 #define PLAYER_TRADING_STATE_IDLE 0x80
 #define PLAYER_TRADING_STATE_BUSY 0x81
@@ -1497,16 +1498,24 @@ void CB1_Overworld(void)
 
 static void OverworldBasic(void)
 {
+    TRACE_BEGIN(TRACE_OVERWORLD);
+    TRACE_BEGIN(TRACE_SCRIPT);
     ScriptContext2_RunScript();
+    TRACE_END(TRACE_SCRIPT);
     RunTasks();
     AnimateSprites();
     CameraUpdate();
     UpdateCameraPanning();
-    BuildOamBufferNoOrder();
+    BuildOamBuffer();
+    TRACE_BEGIN(TRACE_PALETTE_FADE);
     UpdatePaletteFade();
+    TRACE_END(TRACE_PALETTE_FADE);
     UpdateTilesetAnimations();
     DoScheduledBgTilemapCopiesToVram();
+    TRACE_BEGIN(TRACE_DNS_FILTERS);
     DnsApplyFilters();
+    TRACE_END(TRACE_DNS_FILTERS);
+    TRACE_END(TRACE_OVERWORLD);
 }
 
 // This CB2 is used when starting
@@ -3175,6 +3184,7 @@ static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s1
     SetSpritePosToMapCoords(x, y, &objEvent->initialCoords.x, &objEvent->initialCoords.y);
     objEvent->initialCoords.x += 8;
     ObjectEventUpdateZCoord(objEvent);
+    UpdateObjectEventOccupancy(objEvent);
 }
 
 static void sub_80877DC(u8 linkPlayerId, u8 a2)
@@ -3196,6 +3206,7 @@ static void sub_808780C(u8 linkPlayerId)
         DestroySprite(&gSprites[objEvent->spriteId]);
     linkPlayerObjEvent->active = 0;
     objEvent->active = 0;
+    UpdateObjectEventOccupancy(objEvent);
 }
 
 // Returns the spriteId corresponding to this player.
@@ -3369,9 +3380,11 @@ static u8 FlipVerticalAndClearForced(u8 newFacing, u8 oldFacing)
 static u8 LinkPlayerDetectCollision(u8 selfObjEventId, u8 a2, s16 x, s16 y)
 {
     u8 i;
-    for (i = 0; i < 16; i++)
+    u16 objectEvents = GetObjectEventOccupancyAt(x, y);
+
+    for (i = 0; objectEvents != 0; i++, objectEvents >>= 1)
     {
-        if (i != selfObjEventId)
+        if ((objectEvents & 1) && i != selfObjEventId)
         {
             if ((gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
              || (gObjectEvents[i].previousCoords.x == x && gObjectEvents[i].previousCoords.y == y))
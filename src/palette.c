@@ -1,6 +1,7 @@
 #include "global.h"
 #include "palette.h"
 #include "util.h"
+#include "color_lut.h"
 #include "decompress.h"
 #include "gpu_regs.h"
 #include "task.h"
@@ -93,18 +94,21 @@ void LoadCompressedPalette(const u32 *src, u16 offset, u16 size)
     LZDecompressWram(src, gPaletteDecompressionBuffer);
     CpuCopy16(gPaletteDecompressionBuffer, gPlttBufferUnfaded + offset, size);
     CpuCopy16(gPaletteDecompressionBuffer, gPlttBufferFaded + offset, size);
+    DnsMarkPaletteRangeDirty(offset, size);
 }
 
 void LoadPalette(const void *src, u16 offset, u16 size)
 {
     CpuCopy16(src, gPlttBufferUnfaded + offset, size);
     CpuCopy16(src, gPlttBufferFaded + offset, size);
+    DnsMarkPaletteRangeDirty(offset, size);
 }
 
 void FillPalette(u16 value, u16 offset, u16 size)
 {
     CpuFill16(value, gPlttBufferUnfaded + offset, size);
     CpuFill16(value, gPlttBufferFaded + offset, size);
+    DnsMarkPaletteRangeDirty(offset, size);
 }
 
 void TransferPlttBuffer(void)
@@ -128,6 +132,13 @@ u8 UpdatePaletteFade(void)
     if (sPlttBufferTransferPending)
         return PALETTE_FADE_STATUS_LOADING;
 
+    // Software fades rewrite gPlttBufferFaded, so the DNS has to filter
+    // those palettes again. Normal fades clear the selection when they end.
+    if (gPaletteFade.active && gPaletteFade.mode == NORMAL_FADE)
+        DnsMarkPalettesDirty(gPaletteFade_selectedPalettes);
+    else if (gPaletteFade.active && gPaletteFade.mode == FAST_FADE)
+        DnsMarkPalettesDirty(0xFFFFFFFF);
+
     if (gPaletteFade.mode == NORMAL_FADE)
         result = UpdateNormalPaletteFade();
     else if (gPaletteFade.mode == FAST_FADE)
@@ -897,7 +908,7 @@ void TintPalette_GrayScale2(u16 *palette, u16 count)
     }
 }
 
-void TintPalette_SepiaTone(u16 *palette, u16 count)
+static void TintPaletteWithToneLut(u16 *palette, u16 count)
 {
     s32 r, g, b, i;
     u32 gray;
@@ -908,45 +919,23 @@ void TintPalette_SepiaTone(u16 *palette, u16 count)
         g = (*palette >>  5) & 0x1F;
         b = (*palette >> 10) & 0x1F;
 
+        // The weights add up to 1.0, so gray never exceeds 31.
         gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
 
-        r = (u16)((Q_8_8(1.2) * gray)) >> 8;
-        g = (u16)((Q_8_8(1.0) * gray)) >> 8;
-        b = (u16)((Q_8_8(0.94) * gray)) >> 8;
-
-        if (r > 31)
-            r = 31;
-
-        *palette++ = (b << 10) | (g << 5) | (r << 0);
+        *palette++ = gToneLut[gray];
     }
 }
 
-void TintPalette_CustomTone(u16 *palette, u16 count, u16 rTone, u16 gTone, u16 bTone)
+void TintPalette_SepiaTone(u16 *palette, u16 count)
 {
-    s32 r, g, b, i;
-    u32 gray;
-
-    for (i = 0; i < count; i++)
-    {
-        r = (*palette >>  0) & 0x1F;
-        g = (*palette >>  5) & 0x1F;
-        b = (*palette >> 10) & 0x1F;
-
-        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
-
-        r = (u16)((rTone * gray)) >> 8;
-        g = (u16)((gTone * gray)) >> 8;
-        b = (u16)((bTone * gray)) >> 8;
-
-        if (r > 31)
-            r = 31;
-        if (g > 31)
-            g = 31;
-        if (b > 31)
-            b = 31;
+    SetToneLut(Q_8_8(1.2), Q_8_8(1.0), Q_8_8(0.94));
+    TintPaletteWithToneLut(palette, count);
+}
 
-        *palette++ = (b << 10) | (g << 5) | (r << 0);
-    }
+void TintPalette_CustomTone(u16 *palette, u16 count, u16 rTone, u16 gTone, u16 bTone)
+{
+    SetToneLut(rTone, gTone, bTone);
+    TintPaletteWithToneLut(palette, count);
 }
 
 #define tCoeff       data[0]
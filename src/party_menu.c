@@ -2596,9 +2596,6 @@ static void TransparentBlitPartyWindow(u8 windowId, u8 x, u8 y, u8 width, u8 hei
     u8 *pixels = AllocZeroed(height * width * 32);
     u8 i, j, c = 18;
     
-    struct Bitmap sourceRect;
-    struct Bitmap destRect;
-    
     if (width == 0 && height == 0)
     {
         width = 18;
@@ -2611,15 +2608,8 @@ static void TransparentBlitPartyWindow(u8 windowId, u8 x, u8 y, u8 width, u8 hei
             for (j = 0; j < width; j++)
                 CpuCopy16(GetPartyMenuModernBgTile(sOtherSlotsTileNumsModern_Egg[x + j + ((y + i) * c)]), &pixels[(i * width + j) * 32], 32);
         }
-        sourceRect.pixels = (u8*)pixels;
-        sourceRect.width = width * 8;
-        sourceRect.height = height * 8;
-
-        destRect.pixels = gWindows[windowId].tileData;
-        destRect.width = 8 * gWindows[windowId].window.width;
-        destRect.height = 8 * gWindows[windowId].window.height;
 
-        BlitBitmapRect4Bit(&sourceRect, &destRect, 0, 0, x * 8, y * 8, width * 8, height * 8, 0xFE);
+        BlitBitmapRectToWindowWithColorKey(windowId, pixels, 0, 0, width * 8, height * 8, x * 8, y * 8, width * 8, height * 8, 0xFE);
 
 
         Free(pixels);
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "battle_main.h"
 #include "bg.h"
+#include "bitset.h"
 #include "data.h"
 #include "decompress.h"
 #include "event_data.h"
@@ -106,6 +107,9 @@ enum
 
 // EWRAM
 static EWRAM_DATA struct PokedexView *sPokedexView = NULL;
+// Holds sPokedexView and, past sPokedexScreenMark, the current page's bg tilemaps.
+static EWRAM_DATA struct Arena sPokedexArena = {0};
+static EWRAM_DATA u32 sPokedexScreenMark = 0;
 static EWRAM_DATA u16 sLastSelectedPokemon = 0;
 static EWRAM_DATA u8 sPokeBallRotation = 0;
 static EWRAM_DATA struct PokedexListItem *sPokedexListItem = NULL;
@@ -1608,7 +1612,9 @@ void CB2_OpenPokedex(void)
         gMain.state++;
         break;
     case 2:
-        sPokedexView = AllocZeroed(sizeof(struct PokedexView));
+        InitArena(&sPokedexArena, sizeof(struct PokedexView) + 4 * BG_SCREEN_SIZE);
+        sPokedexView = ArenaAllocZeroed(&sPokedexArena, sizeof(struct PokedexView));
+        sPokedexScreenMark = GetArenaMark(&sPokedexArena);
         ResetPokedexView(sPokedexView);
         CreateTask(Task_OpenPokedexMainPage, 0);
         sPokedexView->dexMode = gSaveBlock2Ptr->pokedex.mode;
@@ -1833,7 +1839,7 @@ static void Task_ClosePokedex(u8 taskId)
         DestroyTask(taskId);
         SetMainCallback2(CB2_ReturnToFieldWithOpenMenu);
         m4aMPlayVolumeControl(&gMPlayInfo_BGM, 0xFFFF, 0x100);
-        Free(sPokedexView);
+        FreeArena(&sPokedexArena);
     }
 }
 
@@ -2037,10 +2043,11 @@ static bool8 LoadPokedexListPage(u8 page)
         SetGpuReg(REG_OFFSET_BG2VOFS, sPokedexView->initialVOffset);
         ResetBgsAndClearDma3BusyFlags(0);
         InitBgsFromTemplates(0, sPokedex_BgTemplate, ARRAY_COUNT(sPokedex_BgTemplate));
-        SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-        SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+        ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
+        SetBgTilemapBuffer(3, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(2, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(1, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+        SetBgTilemapBuffer(0, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
         DecompressAndLoadBgGfxUsingHeap(3, gPokedexMenu_Gfx, 0x2000, 0, 0);
         CopyToBgTilemapBuffer(1, gPokedexList_Tilemap, 0, 0);
         CopyToBgTilemapBuffer(3, gPokedexListUnderlay_Tilemap, 0, 0);
@@ -2128,151 +2135,211 @@ static void LoadPokedexBgPalette(bool8 isSearchResults)
 
 static void FreeWindowAndBgBuffers(void)
 {
-    void* tilemapBuffer;
-
     FreeAllWindowBuffers();
-    tilemapBuffer = GetBgTilemapBuffer(0);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(1);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(2);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(3);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
+    ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
 }
 
-static void CreatePokedexList(u8 dexMode, u8 order)
+// The seen and caught flags a word at a time. Bit n of word n / 32 is
+// national dex number n + 1, as in the save's byte arrays.
+#define DEX_FLAG_BITS  (NATIONAL_DEX_COUNT - 1)
+#define DEX_FLAG_WORDS ((DEX_FLAG_BITS + 31) / 32)
+
+static bool32 IsDexFlagSet(const u32 *flags, u32 dexNum)
 {
-    u32 vars[3]; //I have no idea why three regular variables are stored in an array, but whatever.
-#define temp_dexCount   vars[0]
-#define temp_isHoennDex vars[1]
-#define temp_dexNum     vars[2]
-    s32 i;
+    if (dexNum == 0 || dexNum > DEX_FLAG_BITS)
+        return FALSE;
+    dexNum--;
+    return (flags[dexNum / 32] >> (dexNum % 32)) & 1;
+}
 
-    sPokedexView->pokemonListCount = 0;
+static u32 ReadDexFlagWord(const u8 *flags, u32 word)
+{
+    flags += word * 4;
+    return flags[0] | (flags[1] << 8) | (flags[2] << 16) | (flags[3] << 24);
+}
 
-    switch (dexMode)
+static void GetDexFlagWords(u32 *seen, u32 *caught, bool32 hoennOnly)
+{
+    u32 hoenn[DEX_FLAG_WORDS];
+    u32 i, dexNum;
+
+    for (i = 0; i < DEX_FLAG_WORDS; i++)
     {
-    default:
-    case DEX_MODE_HOENN:
-        temp_dexCount = HOENN_DEX_COUNT;
-        temp_isHoennDex = TRUE;
-        break;
-    case DEX_MODE_NATIONAL:
-            temp_dexCount = NATIONAL_DEX_COUNT;
-            temp_isHoennDex = FALSE;
-        break;
+        seen[i] = ReadDexFlagWord(gSaveBlock1Ptr->dexSeen, i);
+        caught[i] = ReadDexFlagWord(gSaveBlock1Ptr->dexCaught, i);
     }
+#if DEX_FLAG_BITS % 32 != 0
+    seen[DEX_FLAG_WORDS - 1] &= (1 << (DEX_FLAG_BITS % 32)) - 1;
+    caught[DEX_FLAG_WORDS - 1] &= (1 << (DEX_FLAG_BITS % 32)) - 1;
+#endif
 
-    switch (order)
+    if (hoennOnly)
     {
-    case ORDER_NUMERICAL:
-        if (temp_isHoennDex)
+        memset(hoenn, 0, sizeof(hoenn));
+        for (i = 1; i < HOENN_DEX_COUNT; i++)
         {
-            for (i = 0; i < temp_dexCount; i++)
-            {
-                temp_dexNum = HoennToNationalOrder(i + 1);
-                sPokedexView->pokedexList[i].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[i].seen = GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN);
-                sPokedexView->pokedexList[i].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
-                if (sPokedexView->pokedexList[i].seen)
-                    sPokedexView->pokemonListCount = i + 1;
-            }
+            dexNum = HoennToNationalOrder(i) - 1;
+            if (dexNum < DEX_FLAG_BITS)
+                hoenn[dexNum / 32] |= 1 << (dexNum % 32);
         }
-        else
+        for (i = 0; i < DEX_FLAG_WORDS; i++)
         {
-            s16 r5, r10;
-            for (i = 0, r5 = 0, r10 = 0; i < temp_dexCount; i++)
-            {
-                temp_dexNum = i + 1;
-                if (GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN))
-                    r10 = 1;
-                if (r10)
-                {
-                    sPokedexView->pokedexList[r5].dexNum = temp_dexNum;
-                    sPokedexView->pokedexList[r5].seen = GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN);
-                    sPokedexView->pokedexList[r5].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
-                    if (sPokedexView->pokedexList[r5].seen)
-                        sPokedexView->pokemonListCount = r5 + 1;
-                    r5++;
-                }
-            }
+            seen[i] &= hoenn[i];
+            caught[i] &= hoenn[i];
         }
-        break;
-    case ORDER_ALPHABETICAL:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Alphabetical); i++)
-        {
-            temp_dexNum = gPokedexOrder_Alphabetical[i];
+    }
+}
 
-            if ((!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_SEEN))
-            {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT);
-                sPokedexView->pokemonListCount++;
-            }
-        }
+// Lists the dex numbers set in listFlags in the given order. Each one is
+// placed by its generated rank, so only the set bits are visited rather
+// than the whole order.
+static void CreatePokedexListFromFlags(const u32 *listFlags, const u32 *caught, u8 dexMode, u8 order)
+{
+    u32 ranked[DEX_FLAG_WORDS];
+    const u16 *dexOrder;
+    const u16 *ranks;
+    bool32 reverse = FALSE;
+    u32 i, j, word, bit, bits, rank, dexNum;
+    u16 count = 0;
+
+    switch (order)
+    {
+    case ORDER_ALPHABETICAL:
+        dexOrder = gPokedexOrder_Alphabetical;
+        ranks = gPokedexRank_Alphabetical;
         break;
     case ORDER_HEAVIEST:
-        for (i = ARRAY_COUNT(gPokedexOrder_Weight) - 1; i >= 0; i--)
-        {
-            temp_dexNum = gPokedexOrder_Weight[i];
+        reverse = TRUE;
+        // fall through
+    case ORDER_LIGHTEST:
+        dexOrder = gPokedexOrder_Weight;
+        ranks = gPokedexRank_Weight;
+        break;
+    case ORDER_TALLEST:
+        reverse = TRUE;
+        // fall through
+    case ORDER_SMALLEST:
+        dexOrder = gPokedexOrder_Height;
+        ranks = gPokedexRank_Height;
+        break;
+    default:
+        dexOrder = NULL;
+        ranks = NULL;
+        break;
+    }
 
-            if ((!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+    if (dexOrder == NULL && dexMode != DEX_MODE_NATIONAL)
+    {
+        for (i = 1; i < HOENN_DEX_COUNT; i++)
+        {
+            dexNum = HoennToNationalOrder(i);
+            if (IsDexFlagSet(listFlags, dexNum))
             {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
+                sPokedexView->pokedexList[count].dexNum = dexNum;
+                sPokedexView->pokedexList[count].seen = TRUE;
+                sPokedexView->pokedexList[count].owned = IsDexFlagSet(caught, dexNum);
+                count++;
             }
         }
-        break;
-    case ORDER_LIGHTEST:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Weight); i++)
-        {
-            temp_dexNum = gPokedexOrder_Weight[i];
+        sPokedexView->pokemonListCount = count;
+        return;
+    }
 
-            if ((!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+    if (dexOrder == NULL)
+    {
+        memcpy(ranked, listFlags, sizeof(ranked));
+    }
+    else
+    {
+        memset(ranked, 0, sizeof(ranked));
+        for (i = 0; i < DEX_FLAG_WORDS; i++)
+        {
+            for (bits = listFlags[i], j = 0; bits != 0; bits >>= 1, j++)
             {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
+                rank = ranks[i * 32 + j + 1];
+                if ((bits & 1) && rank < DEX_FLAG_WORDS * 32)
+                    ranked[rank / 32] |= 1 << (rank % 32);
             }
         }
-        break;
-    case ORDER_TALLEST:
-        for (i = ARRAY_COUNT(gPokedexOrder_Height) - 1; i >= 0; i--)
+    }
+
+    for (i = 0; i < DEX_FLAG_WORDS; i++)
+    {
+        word = reverse ? DEX_FLAG_WORDS - 1 - i : i;
+        if (ranked[word] == 0)
+            continue;
+
+        for (j = 0; j < 32; j++)
         {
-            temp_dexNum = gPokedexOrder_Height[i];
+            bit = reverse ? 31 - j : j;
+            if (!((ranked[word] >> bit) & 1))
+                continue;
+
+            rank = word * 32 + bit;
+            dexNum = dexOrder != NULL ? dexOrder[rank] : rank + 1;
+            sPokedexView->pokedexList[count].dexNum = dexNum;
+            sPokedexView->pokedexList[count].seen = TRUE;
+            sPokedexView->pokedexList[count].owned = IsDexFlagSet(caught, dexNum);
+            count++;
+        }
+    }
+    sPokedexView->pokemonListCount = count;
+}
+
+static void CreatePokedexList(u8 dexMode, u8 order)
+{
+    u32 seen[DEX_FLAG_WORDS];
+    u32 caught[DEX_FLAG_WORDS];
+    u32 dexNum;
+    s32 i, listed;
+    bool32 isHoennDex = (dexMode != DEX_MODE_NATIONAL);
+
+    GetDexFlagWords(seen, caught, isHoennDex);
+    sPokedexView->pokemonListCount = 0;
 
-            if ((!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+    switch (order)
+    {
+    case ORDER_NUMERICAL:
+        if (isHoennDex)
+        {
+            for (i = 0; i < HOENN_DEX_COUNT; i++)
             {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
+                dexNum = HoennToNationalOrder(i + 1);
+                sPokedexView->pokedexList[i].dexNum = dexNum;
+                sPokedexView->pokedexList[i].seen = IsDexFlagSet(seen, dexNum);
+                sPokedexView->pokedexList[i].owned = IsDexFlagSet(caught, dexNum);
+                if (sPokedexView->pokedexList[i].seen)
+                    sPokedexView->pokemonListCount = i + 1;
             }
         }
-        break;
-    case ORDER_SMALLEST:
-        for (i = 0; i < ARRAY_COUNT(gPokedexOrder_Height); i++)
+        else
         {
-            temp_dexNum = gPokedexOrder_Height[i];
-
-            if ((!temp_isHoennDex || NationalToHoennOrder(temp_dexNum) != 0) && GetSetPokedexFlag(temp_dexNum, FLAG_GET_CAUGHT))
+            // The list starts at the first seen Pokémon, and unseen ones
+            // after it are shown as blanks.
+            for (i = 0; i < DEX_FLAG_WORDS && seen[i] == 0; i++)
+                ;
+            for (dexNum = i * 32 + 1, listed = 0; dexNum < NATIONAL_DEX_COUNT; dexNum++)
             {
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].dexNum = temp_dexNum;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].seen = TRUE;
-                sPokedexView->pokedexList[sPokedexView->pokemonListCount].owned = TRUE;
-                sPokedexView->pokemonListCount++;
+                if (listed == 0 && !IsDexFlagSet(seen, dexNum))
+                    continue;
+                sPokedexView->pokedexList[listed].dexNum = dexNum;
+                sPokedexView->pokedexList[listed].seen = IsDexFlagSet(seen, dexNum);
+                sPokedexView->pokedexList[listed].owned = IsDexFlagSet(caught, dexNum);
+                if (sPokedexView->pokedexList[listed].seen)
+                    sPokedexView->pokemonListCount = listed + 1;
+                listed++;
             }
         }
         break;
+    case ORDER_ALPHABETICAL:
+        CreatePokedexListFromFlags(seen, caught, dexMode, order);
+        break;
+    case ORDER_HEAVIEST:
+    case ORDER_LIGHTEST:
+    case ORDER_TALLEST:
+    case ORDER_SMALLEST:
+        CreatePokedexListFromFlags(caught, caught, dexMode, order);
+        break;
     }
 
     for (i = sPokedexView->pokemonListCount; i < NATIONAL_DEX_COUNT; i++)
@@ -3096,10 +3163,11 @@ static u8 LoadInfoScreen(struct PokedexListItem* item, u8 monSpriteId)
     gTasks[taskId].data[5] = 255;
     ResetBgsAndClearDma3BusyFlags(0);
     InitBgsFromTemplates(0, sInfoScreen_BgTemplate, ARRAY_COUNT(sInfoScreen_BgTemplate));
-    SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-    SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+    ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
+    SetBgTilemapBuffer(3, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(2, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(1, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+    SetBgTilemapBuffer(0, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
     InitWindows(sInfoScreen_WindowTemplates);
     DeactivateAllTextPrinters();
 
@@ -3239,21 +3307,8 @@ static void Task_LoadInfoScreen(u8 taskId)
 
 static void FreeInfoScreenWindowAndBgBuffers(void)
 {
-    void *tilemapBuffer;
-
     FreeAllWindowBuffers();
-    tilemapBuffer = GetBgTilemapBuffer(0);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(1);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(2);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(3);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
+    ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
 }
 
 static void Task_HandleInfoScreenInput(u8 taskId)
@@ -4178,70 +4233,35 @@ s8 GetSetPokedexFlag(u16 nationalDexNo, u8 caseID)
     return retVal;
 }
 
-u16 GetNationalPokedexCount(u8 caseID)
+static const u8 *GetDexFlagBits(u8 caseID)
 {
-    u16 count = 0;
-    u16 i;
+    if (caseID == FLAG_GET_CAUGHT)
+        return gSaveBlock1Ptr->dexCaught;
+    return gSaveBlock1Ptr->dexSeen;
+}
 
-    for (i = 0; i < NATIONAL_DEX_COUNT; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
-    return count;
+u16 GetNationalPokedexCount(u8 caseID)
+{
+    return BitsetCount(GetDexFlagBits(caseID), 0, DEX_FLAG_BITS);
 }
 
 u16 GetHoennPokedexCount(u8 caseID)
 {
+    u32 seen[DEX_FLAG_WORDS];
+    u32 caught[DEX_FLAG_WORDS];
+    u32 *flags = (caseID == FLAG_GET_CAUGHT) ? caught : seen;
     u16 count = 0;
-    u16 i;
+    u32 i;
 
-    for (i = 0; i < HOENN_DEX_COUNT; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(HoennToNationalOrder(i + 1), FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
+    GetDexFlagWords(seen, caught, TRUE);
+    for (i = 0; i < DEX_FLAG_WORDS; i++)
+        count += CountSetBits(flags[i]);
     return count;
 }
 
 u16 GetKantoPokedexCount(u8 caseID)
 {
-    u16 count = 0;
-    u16 i;
-
-    for (i = 0; i < KANTO_DEX_COUNT; i++)
-    {
-        switch (caseID)
-        {
-        case FLAG_GET_SEEN:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_SEEN))
-                count++;
-            break;
-        case FLAG_GET_CAUGHT:
-            if (GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-                count++;
-            break;
-        }
-    }
-    return count;
+    return BitsetCount(GetDexFlagBits(caseID), 0, KANTO_DEX_COUNT);
 }
 
 extern int RyuGetTotalCaughtMons(void);
@@ -4254,41 +4274,25 @@ bool16 HasAllHoennMons(void)
 
 bool8 HasAllKantoMons(void)
 {
-    u16 i;
-
     // -1 excludes Mew
-    for (i = 0; i < KANTO_DEX_COUNT - 1; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
-    return TRUE;
+    return BitsetFindFirstClear(gSaveBlock1Ptr->dexCaught, 0, KANTO_DEX_COUNT - 1) < 0;
 }
 
 bool16 HasAllMons(void)
 {
-    u16 i;
+    const u8 *caught = gSaveBlock1Ptr->dexCaught;
 
     // -1 excludes Mew
-    for (i = 0; i < KANTO_DEX_COUNT - 1; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (BitsetFindFirstClear(caught, 0, KANTO_DEX_COUNT - 1) >= 0)
+        return FALSE;
 
     // -3 excludes Lugia, Ho-Oh, and Celebi
-    for (i = KANTO_DEX_COUNT; i < JOHTO_DEX_COUNT - 3; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (BitsetFindFirstClear(caught, KANTO_DEX_COUNT, JOHTO_DEX_COUNT - 3 - KANTO_DEX_COUNT) >= 0)
+        return FALSE;
 
     // -2 excludes Jirachi and Deoxys
-    for (i = JOHTO_DEX_COUNT; i < NATIONAL_DEX_COUNT - 2; i++)
-    {
-        if (!GetSetPokedexFlag(i + 1, FLAG_GET_CAUGHT))
-            return FALSE;
-    }
+    if (BitsetFindFirstClear(caught, JOHTO_DEX_COUNT, NATIONAL_DEX_COUNT - 2 - JOHTO_DEX_COUNT) >= 0)
+        return FALSE;
     return TRUE;
 }
 
@@ -4523,22 +4527,29 @@ static u16 CreateSizeScreenTrainerPic(u16 species, s16 x, s16 y, s8 paletteSlot)
 
 static int DoPokedexSearch(u8 dexMode, u8 order, u8 abcGroup, u8 bodyColor, u8 type1, u8 type2)
 {
+    u32 seen[DEX_FLAG_WORDS];
+    u32 caught[DEX_FLAG_WORDS];
     u16 species;
     u16 i;
     u16 resultsCount;
     u8 types[2];
 
-    CreatePokedexList(dexMode, order);
-
-    for (i = 0, resultsCount = 0; i < NATIONAL_DEX_COUNT; i++)
+    // Only seen Pokémon are searched. The weight and height orders and the
+    // type search only cover caught ones, so those start from the caught
+    // flags instead.
+    GetDexFlagWords(seen, caught, dexMode != DEX_MODE_NATIONAL);
+    if (order == ORDER_NUMERICAL || order == ORDER_ALPHABETICAL)
     {
-        if (sPokedexView->pokedexList[i].seen)
-        {
-            sPokedexView->pokedexList[resultsCount] = sPokedexView->pokedexList[i];
-            resultsCount++;
-        }
+        if (type1 != TYPE_NONE || type2 != TYPE_NONE)
+            CreatePokedexListFromFlags(caught, caught, dexMode, order);
+        else
+            CreatePokedexListFromFlags(seen, caught, dexMode, order);
+    }
+    else
+    {
+        CreatePokedexListFromFlags(caught, caught, dexMode, order);
     }
-    sPokedexView->pokemonListCount = resultsCount;
+    resultsCount = sPokedexView->pokemonListCount;
 
     // Search by name
     if (abcGroup != 0xFF)
@@ -4687,10 +4698,11 @@ static void Task_LoadSearchMenu(u8 taskId)
             ResetOtherVideoRegisters(0);
             ResetBgsAndClearDma3BusyFlags(0);
             InitBgsFromTemplates(0, sSearchMenu_BgTemplate, ARRAY_COUNT(sSearchMenu_BgTemplate));
-            SetBgTilemapBuffer(3, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(2, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(1, AllocZeroed(BG_SCREEN_SIZE));
-            SetBgTilemapBuffer(0, AllocZeroed(BG_SCREEN_SIZE));
+            ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
+            SetBgTilemapBuffer(3, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(2, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(1, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
+            SetBgTilemapBuffer(0, ArenaAllocZeroed(&sPokedexArena, BG_SCREEN_SIZE));
             InitWindows(sSearchMenu_WindowTemplate);
             DeactivateAllTextPrinters();
             PutWindowTilemap(0);
@@ -4742,21 +4754,8 @@ static void Task_LoadSearchMenu(u8 taskId)
 
 static void FreeSearchWindowAndBgBuffers(void)
 {
-    void* tilemapBuffer;
-
     FreeAllWindowBuffers();
-    tilemapBuffer = GetBgTilemapBuffer(0);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(1);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(2);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
-    tilemapBuffer = GetBgTilemapBuffer(3);
-    if (tilemapBuffer)
-        Free(tilemapBuffer);
+    ResetArenaToMark(&sPokedexArena, sPokedexScreenMark);
 }
 
 static void Task_SwitchToSearchMenuTopBar(u8 taskId)
@@ -181,6 +181,11 @@ static EWRAM_DATA struct PokemonSummaryScreenData
     u8 splitIconSpriteId;
 } *sMonSummaryScreen = NULL;
 
+// sMonSummaryScreen followed by scratch space for the temporary text and
+// tilemap buffers, which are released with ResetArenaToMark when done.
+#define SUMMARY_SCRATCH_SIZE 0x100
+static EWRAM_DATA struct Arena sSummaryArena = {0};
+
 EWRAM_DATA u8 gLastViewedMonIndex = 0;
 static EWRAM_DATA u8 sMoveSlotToReplace = 0;
 ALIGNED(4) static EWRAM_DATA u8 sUnknownTaskId = 0;
@@ -1493,7 +1498,8 @@ static void DestroySplitIcon(void)
 
 void ShowPokemonSummaryScreen(u8 mode, void *mons, u8 monIndex, u8 maxMonIndex, void (*callback)(void))
 {
-    sMonSummaryScreen = AllocZeroed(sizeof(*sMonSummaryScreen));
+    InitArena(&sSummaryArena, sizeof(*sMonSummaryScreen) + SUMMARY_SCRATCH_SIZE);
+    sMonSummaryScreen = ArenaAllocZeroed(&sSummaryArena, sizeof(*sMonSummaryScreen));
     sMonSummaryScreen->mode = mode;
     sMonSummaryScreen->monList.mons = mons;
     sMonSummaryScreen->curMonIndex = monIndex;
@@ -2022,7 +2028,7 @@ static void SetDefaultTilemaps(void)
 static void FreeSummaryScreen(void)
 {
     FreeAllWindowBuffers();
-    Free(sMonSummaryScreen);
+    FreeArena(&sSummaryArena);
 }
 
 static void BeginCloseSummaryScreen(u8 taskId)
@@ -2780,7 +2786,8 @@ u8 GetMoveSlotToReplace(void)
 
 static void DrawPagination(void) // Updates the pagination dots at the top of the summary screen
 {
-    u16 *alloced = Alloc(32);
+    u32 mark = GetArenaMark(&sSummaryArena);
+    u16 *alloced = ArenaAlloc(&sSummaryArena, 32);
     u8 i;
 
     for (i = 0; i < 4; i++)
@@ -2842,13 +2849,14 @@ static void DrawPagination(void) // Updates the pagination dots at the top of th
     }
     CopyToBgTilemapBufferRect_ChangePalette(3, alloced, 11, 0, 8, 2, 16);
     ScheduleBgCopyTilemapToVram(3);
-    Free(alloced);
+    ResetArenaToMark(&sSummaryArena, mark);
 }
 
 static void ChangeTilemap(const struct TilemapCtrl *unkStruct, u16 *dest, u8 c, bool8 d)
 {
     u16 i;
-    u16 *alloced = Alloc(unkStruct->field_6 * 2 * unkStruct->field_7);
+    u32 mark = GetArenaMark(&sSummaryArena);
+    u16 *alloced = ArenaAlloc(&sSummaryArena, unkStruct->field_6 * 2 * unkStruct->field_7);
     CpuFill16(unkStruct->field_4, alloced, unkStruct->field_6 * 2 * unkStruct->field_7);
     if (unkStruct->field_6 != c)
     {
@@ -2867,7 +2875,7 @@ static void ChangeTilemap(const struct TilemapCtrl *unkStruct, u16 *dest, u8 c,
     for (i = 0; i < unkStruct->field_7; i++)
         CpuCopy16(&alloced[unkStruct->field_6 * i], &dest[(unkStruct->field_9 + i) * 32 + unkStruct->field_8], unkStruct->field_6 * 2);
 
-    Free(alloced);
+    ResetArenaToMark(&sSummaryArena, mark);
 }
 
 //FULL_COLOR
@@ -3713,8 +3721,9 @@ static void BufferMonTrainerMemo(void)
     }
     else
     {
-        u8 *metLevelString = Alloc(32);
-        u8 *metLocationString = Alloc(32);
+        u32 mark = GetArenaMark(&sSummaryArena);
+        u8 *metLevelString = ArenaAlloc(&sSummaryArena, 32);
+        u8 *metLocationString = ArenaAlloc(&sSummaryArena, 32);
         GetMetLevelString(metLevelString);
 
         if (sum->metLocation < MAPSEC_NONE)
@@ -3744,8 +3753,7 @@ static void BufferMonTrainerMemo(void)
         }
 
         DynamicPlaceholderTextUtil_ExpandPlaceholders(gStringVar4, text);
-        Free(metLevelString);
-        Free(metLocationString);
+        ResetArenaToMark(&sSummaryArena, mark);
     }
 }
 
@@ -4074,10 +4082,11 @@ static void BufferStat(u8 *dst, s8 natureMod, u32 stat, u32 strId, u32 n)
 
 static void BufferLeftColumnStats(void)
 {
-    u8 *currentHPString = Alloc(20);
-    u8 *maxHPString = Alloc(20);
-    u8 *attackString = Alloc(20);
-    u8 *defenseString = Alloc(20);
+    u32 mark = GetArenaMark(&sSummaryArena);
+    u8 *currentHPString = ArenaAlloc(&sSummaryArena, 20);
+    u8 *maxHPString = ArenaAlloc(&sSummaryArena, 20);
+    u8 *attackString = ArenaAlloc(&sSummaryArena, 20);
+    u8 *defenseString = ArenaAlloc(&sSummaryArena, 20);
     const s8 *natureMod = gNatureStatTable[sMonSummaryScreen->summary.nature];
 
     DynamicPlaceholderTextUtil_Reset();
@@ -4087,10 +4096,7 @@ static void BufferLeftColumnStats(void)
     BufferStat(defenseString, natureMod[STAT_DEF - 1], sMonSummaryScreen->summary.def, 3, 4);
     DynamicPlaceholderTextUtil_ExpandPlaceholders(gStringVar4, sStatsLeftColumnLayout);
 
-    Free(currentHPString);
-    Free(maxHPString);
-    Free(attackString);
-    Free(defenseString);
+    ResetArenaToMark(&sSummaryArena, mark);
 }
 
 //FULL_COLOR
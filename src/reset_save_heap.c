@@ -7,6 +7,7 @@
 #include "new_game.h"
 #include "overworld.h"
 #include "malloc.h"
+#include "text.h"
 
 void sub_81700F8(void)
 {
@@ -26,5 +27,6 @@ void sub_81700F8(void)
         Sav2_ClearSetDefault();
     SetPokemonCryStereo();
     InitHeap(gHeap, HEAP_SIZE);
+    InitGlyphCache();
     SetMainCallback2(CB2_ContinueSavedGame);
 }
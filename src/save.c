@@ -20,13 +20,10 @@ static u8 sub_8152E10(u16 a1, const struct SaveSectionLocation *location);
 static u8 ClearSaveData_2(u16 a1, const struct SaveSectionLocation *location);
 static u8 TryWriteSector(u8 sector, u8 *data);
 static u8 HandleWriteSector(u16 a1, const struct SaveSectionLocation *location);
+static u8 HandleWriteSaveSlot(const struct SaveSectionLocation *location);
 
 // Divide save blocks into individual chunks to be written to flash sectors
 
-// Each 4 KiB flash sector contains 3968 bytes of actual data followed by a 128 byte footer
-#define SECTOR_DATA_SIZE 3968
-#define SECTOR_FOOTER_SIZE 128
-
 /*
  * Sector Layout:
  *
@@ -42,6 +39,13 @@ static u8 HandleWriteSector(u16 a1, const struct SaveSectionLocation *location);
  * so that the same data is not always being written to the same sector. This
  * might be done to reduce wear on the flash memory, but I'm not sure, since all
  * 14 sectors get written anyway.
+ *
+ * Normal saves only rewrite the sectors whose data changed since that slot was
+ * last written, keeping the slot's rotation. Sector ID 0 is always written
+ * last and carries a manifest of the checksums of every sector in the slot,
+ * after the save block data. Until it is written, the sectors that changed
+ * don't match the manifest and the slot is treated as corrupt, so an
+ * interrupted save still falls back to the other slot.
  */
 
 // (u8 *)structure was removed from the first statement of the macro in Emerald.
@@ -145,13 +149,10 @@ static u8 SaveWriteToFlash(u16 a1, const struct SaveSectionLocation *location)
     {
         gLastKnownGoodSector = gLastWrittenSector; // backup the current written sector before attempting to write.
         gLastSaveCounter = gSaveCounter;
-        gLastWrittenSector++;
-        gLastWrittenSector = gLastWrittenSector % SECTOR_SAVE_SLOT_LENGTH; // array count save sector locations
         gSaveCounter++;
         status = SAVE_STATUS_OK;
 
-        for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
-            HandleWriteSector(i, location);
+        HandleWriteSaveSlot(location);
 
         if (gDamagedSaveSectors != 0) // skip the damaged sector.
         {
@@ -164,16 +165,21 @@ static u8 SaveWriteToFlash(u16 a1, const struct SaveSectionLocation *location)
     return status;
 }
 
-static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *location)
+static u16 GetSaveSlotSector(u16 sectorId)
 {
-    u16 i;
     u16 sector;
-    u8 *data;
-    u16 size;
 
     sector = sectorId + gLastWrittenSector;
     sector %= SECTOR_SAVE_SLOT_LENGTH;
     sector += SECTOR_SAVE_SLOT_LENGTH * (gSaveCounter % 2);
+    return sector;
+}
+
+static void FillSaveSection(u16 sectorId, const struct SaveSectionLocation *location)
+{
+    u16 i;
+    u8 *data;
+    u16 size;
 
     data = location[sectorId].data;
     size = location[sectorId].size;
@@ -190,7 +196,120 @@ static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *loca
         gFastSaveSection->data[i] = data[i];
 
     gFastSaveSection->checksum = CalculateChecksum(data, size);
-    return TryWriteSector(sector, gFastSaveSection->data);
+}
+
+static u8 HandleWriteSector(u16 sectorId, const struct SaveSectionLocation *location)
+{
+    FillSaveSection(sectorId, location);
+    return TryWriteSector(GetSaveSlotSector(sectorId), gFastSaveSection->data);
+}
+
+static bool8 IsSaveSlotManifestValid(const struct SaveSlotManifest *manifest)
+{
+    return manifest->magic == SAVE_MANIFEST_MAGIC
+        && manifest->manifestChecksum == CalculateChecksum((void *)manifest, offsetof(struct SaveSlotManifest, manifestChecksum));
+}
+
+// Reads the footers of the slot about to be written. If it holds a complete
+// save with a manifest, returns the sector ID 0 is in and fills checksums with
+// what each sector holds. Otherwise returns -1 and erases the slot's sector
+// ID 0 if it has one, so the slot stays invalid until it is fully rewritten.
+static s32 GetSaveSlotRotation(u16 *checksums)
+{
+    u16 i;
+    u16 slotStart = SECTOR_SAVE_SLOT_LENGTH * (gSaveCounter % 2);
+    u8 ids[SECTOR_SAVE_SLOT_LENGTH];
+    s32 rotation = -1;
+    bool8 complete = TRUE;
+
+    for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
+    {
+        ReadFlash(slotStart + i, offsetof(struct SaveSection, id), (u8 *)&gFastSaveSection->id,
+                  sizeof(struct SaveSection) - offsetof(struct SaveSection, id));
+        ids[i] = gFastSaveSection->id;
+        if (gFastSaveSection->security != UNKNOWN_CHECK_VALUE || gFastSaveSection->id >= SECTOR_SAVE_SLOT_LENGTH)
+        {
+            complete = FALSE;
+            continue;
+        }
+        if (gFastSaveSection->id == SECTOR_ID_SAVEBLOCK2)
+            rotation = i;
+        checksums[gFastSaveSection->id] = gFastSaveSection->checksum;
+    }
+
+    if (rotation >= 0)
+    {
+        for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
+        {
+            if (ids[(i + rotation) % SECTOR_SAVE_SLOT_LENGTH] != i)
+                complete = FALSE;
+        }
+        if (complete)
+        {
+            ReadFlash(slotStart + rotation, SECTOR_DATA_SIZE, (u8 *)SAVE_SLOT_MANIFEST(gFastSaveSection), sizeof(struct SaveSlotManifest));
+            if (!IsSaveSlotManifestValid(SAVE_SLOT_MANIFEST(gFastSaveSection)))
+                complete = FALSE;
+        }
+        if (!complete)
+        {
+            EraseFlashSector(slotStart + rotation);
+            rotation = -1;
+        }
+    }
+
+    return rotation;
+}
+
+// Whether the sector already holds exactly this data.
+static bool8 DoesSaveSectorMatch(u16 sectorId, const struct SaveSectionLocation *location)
+{
+    u16 i;
+    u8 *data = location[sectorId].data;
+    u16 size = location[sectorId].size;
+
+    DoReadFlashWholeSection(GetSaveSlotSector(sectorId), gFastSaveSection);
+    if (gFastSaveSection->security != UNKNOWN_CHECK_VALUE || gFastSaveSection->id != sectorId)
+        return FALSE;
+
+    for (i = 0; i < size; i++)
+    {
+        if (gFastSaveSection->data[i] != data[i])
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static u8 HandleWriteSaveSlot(const struct SaveSectionLocation *location)
+{
+    u16 i;
+    s32 rotation;
+    u16 slotChecksums[SECTOR_SAVE_SLOT_LENGTH];
+    struct SaveSlotManifest manifest;
+
+    rotation = GetSaveSlotRotation(slotChecksums);
+    if (rotation >= 0)
+        gLastWrittenSector = rotation;
+    else
+        gLastWrittenSector = (gLastWrittenSector + 1) % SECTOR_SAVE_SLOT_LENGTH;
+
+    manifest.magic = SAVE_MANIFEST_MAGIC;
+    manifest.unused = 0;
+    for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
+        manifest.checksums[i] = CalculateChecksum(location[i].data, location[i].size);
+    manifest.manifestChecksum = CalculateChecksum(&manifest, offsetof(struct SaveSlotManifest, manifestChecksum));
+
+    for (i = SECTOR_ID_SAVEBLOCK2 + 1; i < SECTOR_SAVE_SLOT_LENGTH; i++)
+    {
+        if (rotation >= 0
+         && slotChecksums[i] == manifest.checksums[i]
+         && DoesSaveSectorMatch(i, location))
+            continue;
+        HandleWriteSector(i, location);
+    }
+
+    FillSaveSection(SECTOR_ID_SAVEBLOCK2, location);
+    *SAVE_SLOT_MANIFEST(gFastSaveSection) = manifest;
+    return TryWriteSector(GetSaveSlotSector(SECTOR_ID_SAVEBLOCK2), gFastSaveSection->data);
 }
 
 static u8 HandleWriteSectorNBytes(u8 sector, u8 *data, u16 size)
@@ -472,75 +591,70 @@ static u8 sub_8152E10(u16 a1, const struct SaveSectionLocation *location)
     return SAVE_STATUS_OK;
 }
 
-static u8 GetSaveValidStatus(const struct SaveSectionLocation *location)
+// Slots written with a manifest take their counter from sector ID 0, since
+// sectors that didn't change keep the counter of the save that wrote them.
+static u8 GetSaveSlotStatus(u16 slotStart, const struct SaveSectionLocation *location, u32 *slotCounter)
 {
     u16 i;
     u16 checksum;
-    u32 saveSlot1Counter = 0;
-    u32 saveSlot2Counter = 0;
     u32 slotCheckField = 0;
     bool8 securityPassed = FALSE;
-    u8 saveSlot1Status;
-    u8 saveSlot2Status;
+    bool8 hasManifest = FALSE;
+    u32 manifestCounter = 0;
+    u16 sectorChecksums[SECTOR_SAVE_SLOT_LENGTH];
+    struct SaveSlotManifest manifest;
 
-    // check save slot 1.
     for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
     {
-        DoReadFlashWholeSection(i, gFastSaveSection);
+        DoReadFlashWholeSection(i + slotStart, gFastSaveSection);
         if (gFastSaveSection->security == UNKNOWN_CHECK_VALUE)
         {
             securityPassed = TRUE;
             checksum = CalculateChecksum(gFastSaveSection->data, location[gFastSaveSection->id].size);
             if (gFastSaveSection->checksum == checksum)
             {
-                saveSlot1Counter = gFastSaveSection->counter;
+                *slotCounter = gFastSaveSection->counter;
                 slotCheckField |= 1 << gFastSaveSection->id;
+                sectorChecksums[gFastSaveSection->id] = checksum;
+                if (gFastSaveSection->id == SECTOR_ID_SAVEBLOCK2)
+                {
+                    manifest = *SAVE_SLOT_MANIFEST(gFastSaveSection);
+                    hasManifest = IsSaveSlotManifestValid(&manifest);
+                    if (hasManifest)
+                        manifestCounter = gFastSaveSection->counter;
+                }
             }
         }
     }
 
-    if (securityPassed)
-    {
-        if (slotCheckField == 0x3FFF)
-            saveSlot1Status = SAVE_STATUS_OK;
-        else
-            saveSlot1Status = SAVE_STATUS_ERROR;
-    }
-    else
-    {
-        saveSlot1Status = SAVE_STATUS_EMPTY;
-    }
-
-    slotCheckField = 0;
-    securityPassed = FALSE;
+    if (!securityPassed)
+        return SAVE_STATUS_EMPTY;
+    if (slotCheckField != 0x3FFF)
+        return SAVE_STATUS_ERROR;
 
-    // check save slot 2.
-    for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
+    if (hasManifest)
     {
-        DoReadFlashWholeSection(i + SECTOR_SAVE_SLOT_LENGTH, gFastSaveSection);
-        if (gFastSaveSection->security == UNKNOWN_CHECK_VALUE)
+        for (i = 0; i < SECTOR_SAVE_SLOT_LENGTH; i++)
         {
-            securityPassed = TRUE;
-            checksum = CalculateChecksum(gFastSaveSection->data, location[gFastSaveSection->id].size);
-            if (gFastSaveSection->checksum == checksum)
-            {
-                saveSlot2Counter = gFastSaveSection->counter;
-                slotCheckField |= 1 << gFastSaveSection->id;
-            }
+            if (sectorChecksums[i] != manifest.checksums[i])
+                return SAVE_STATUS_ERROR; // a save into this slot was interrupted
         }
+        *slotCounter = manifestCounter;
     }
+    return SAVE_STATUS_OK;
+}
 
-    if (securityPassed)
-    {
-        if (slotCheckField == 0x3FFF)
-            saveSlot2Status = SAVE_STATUS_OK;
-        else
-            saveSlot2Status = SAVE_STATUS_ERROR;
-    }
-    else
-    {
-        saveSlot2Status = SAVE_STATUS_EMPTY;
-    }
+static u8 GetSaveValidStatus(const struct SaveSectionLocation *location)
+{
+    u32 saveSlot1Counter = 0;
+    u32 saveSlot2Counter = 0;
+    u8 saveSlot1Status;
+    u8 saveSlot2Status;
+
+    // check save slot 1.
+    saveSlot1Status = GetSaveSlotStatus(0, location, &saveSlot1Counter);
+    // check save slot 2.
+    saveSlot2Status = GetSaveSlotStatus(SECTOR_SAVE_SLOT_LENGTH, location, &saveSlot2Counter);
 
     if (saveSlot1Status == SAVE_STATUS_OK && saveSlot2Status == SAVE_STATUS_OK)
     {
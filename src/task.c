@@ -1,10 +1,27 @@
 #include "global.h"
 #include "task.h"
+#include "frame_budget.h"
+#include "trace.h"
+
+#define ALL_TASKS_FREE ((1 << NUM_TASKS) - 1)
 
 struct Task gTasks[NUM_TASKS];
 
+// The run list is kept sorted by priority, so its first and last entries
+// are tracked instead of being searched for. A task whose priority is not
+// lower than the tail's, which is most of them, is appended in O(1).
+static u8 sTaskHead;
+static u8 sTaskTail;
+static u16 sFreeTasks; // Bit n is set while gTasks[n] is free.
+
 static void InsertTask(u8 newTaskId);
-static u8 FindFirstActiveTask(void);
+static u8 LowestSetBit(u32 bits);
+
+static const u8 sDeBruijnBitPositions[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9,
+};
 
 void ResetTasks(void)
 {
@@ -22,40 +39,46 @@ void ResetTasks(void)
 
     gTasks[0].prev = HEAD_SENTINEL;
     gTasks[NUM_TASKS - 1].next = TAIL_SENTINEL;
+
+    sTaskHead = NUM_TASKS;
+    sTaskTail = NUM_TASKS;
+    sFreeTasks = ALL_TASKS_FREE;
 }
 
 u8 CreateTask(TaskFunc func, u8 priority)
 {
     u8 i;
 
-    for (i = 0; i < NUM_TASKS; i++)
-    {
-        if (!gTasks[i].isActive)
-        {
-            gTasks[i].func = func;
-            gTasks[i].priority = priority;
-            InsertTask(i);
-            memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
-            gTasks[i].isActive = TRUE;
-            return i;
-        }
-    }
+    if (sFreeTasks == 0)
+        return 0;
 
-    return 0;
+    i = LowestSetBit(sFreeTasks);
+    sFreeTasks &= ~(1 << i);
+    gTasks[i].func = func;
+    gTasks[i].priority = priority;
+    InsertTask(i);
+    memset(gTasks[i].data, 0, sizeof(gTasks[i].data));
+    gTasks[i].isActive = TRUE;
+    return i;
 }
 
 static void InsertTask(u8 newTaskId)
 {
-    u8 taskId = FindFirstActiveTask();
+    u8 taskId = sTaskHead;
 
     if (taskId == NUM_TASKS)
     {
         // The new task is the only task.
         gTasks[newTaskId].prev = HEAD_SENTINEL;
         gTasks[newTaskId].next = TAIL_SENTINEL;
+        sTaskHead = newTaskId;
+        sTaskTail = newTaskId;
         return;
     }
 
+    if (gTasks[newTaskId].priority >= gTasks[sTaskTail].priority)
+        taskId = sTaskTail;
+
     while (1)
     {
         if (gTasks[newTaskId].priority < gTasks[taskId].priority)
@@ -66,6 +89,8 @@ static void InsertTask(u8 newTaskId)
             gTasks[newTaskId].next = taskId;
             if (gTasks[taskId].prev != HEAD_SENTINEL)
                 gTasks[gTasks[taskId].prev].next = newTaskId;
+            else
+                sTaskHead = newTaskId;
             gTasks[taskId].prev = newTaskId;
             return;
         }
@@ -75,6 +100,7 @@ static void InsertTask(u8 newTaskId)
             gTasks[newTaskId].prev = taskId;
             gTasks[newTaskId].next = gTasks[taskId].next;
             gTasks[taskId].next = newTaskId;
+            sTaskTail = newTaskId;
             return;
         }
         taskId = gTasks[taskId].next;
@@ -86,17 +112,27 @@ void DestroyTask(u8 taskId)
     if (gTasks[taskId].isActive)
     {
         gTasks[taskId].isActive = FALSE;
+        sFreeTasks |= 1 << taskId;
 
         if (gTasks[taskId].prev == HEAD_SENTINEL)
         {
             if (gTasks[taskId].next != TAIL_SENTINEL)
+            {
                 gTasks[gTasks[taskId].next].prev = HEAD_SENTINEL;
+                sTaskHead = gTasks[taskId].next;
+            }
+            else
+            {
+                sTaskHead = NUM_TASKS;
+                sTaskTail = NUM_TASKS;
+            }
         }
         else
         {
             if (gTasks[taskId].next == TAIL_SENTINEL)
             {
                 gTasks[gTasks[taskId].prev].next = TAIL_SENTINEL;
+                sTaskTail = gTasks[taskId].prev;
             }
             else
             {
@@ -109,8 +145,10 @@ void DestroyTask(u8 taskId)
 
 void RunTasks(void)
 {
-    u8 taskId = FindFirstActiveTask();
+    u8 taskId = sTaskHead;
 
+    TRACE_BEGIN(TRACE_RUN_TASKS);
+    FRAME_BUDGET_BEGIN(FRAME_BUDGET_TASKS);
     if (taskId != NUM_TASKS)
     {
         do
@@ -119,17 +157,14 @@ void RunTasks(void)
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
+    FRAME_BUDGET_END(FRAME_BUDGET_TASKS);
+    TRACE_END(TRACE_RUN_TASKS);
 }
 
-static u8 FindFirstActiveTask(void)
+// Index of the lowest set bit. bits must be nonzero.
+static u8 LowestSetBit(u32 bits)
 {
-    u8 taskId;
-
-    for (taskId = 0; taskId < NUM_TASKS; taskId++)
-        if (gTasks[taskId].isActive == TRUE && gTasks[taskId].prev == HEAD_SENTINEL)
-            break;
-
-    return taskId;
+    return sDeBruijnBitPositions[((bits & -bits) * 0x077CB531) >> 27];
 }
 
 void TaskDummy(u8 taskId)
@@ -164,36 +199,39 @@ void SwitchTaskToFollowupFunc(u8 taskId)
     gTasks[taskId].func = (TaskFunc)func;
 }
 
+// Task funcs are reassigned directly all over the codebase, so rather than
+// indexing them these only visit the slots that are in use, in slot order.
 bool8 FuncIsActiveTask(TaskFunc func)
 {
-    u8 i;
-
-    for (i = 0; i < NUM_TASKS; i++)
-        if (gTasks[i].isActive == TRUE && gTasks[i].func == func)
-            return TRUE;
-
-    return FALSE;
+    return FindTaskIdByFunc(func) != 0xFF;
 }
 
 u8 FindTaskIdByFunc(TaskFunc func)
 {
-    s32 i;
+    u32 activeTasks = ~sFreeTasks & ALL_TASKS_FREE;
 
-    for (i = 0; i < NUM_TASKS; i++)
-        if (gTasks[i].isActive == TRUE && gTasks[i].func == func)
-            return (u8)i;
+    while (activeTasks != 0)
+    {
+        u8 i = LowestSetBit(activeTasks);
+
+        if (gTasks[i].func == func)
+            return i;
+        activeTasks &= activeTasks - 1;
+    }
 
     return 0xFF;
 }
 
 u8 GetTaskCount(void)
 {
-    u8 i;
+    u32 activeTasks = ~sFreeTasks & ALL_TASKS_FREE;
     u8 count = 0;
 
-    for (i = 0; i < NUM_TASKS; i++)
-        if (gTasks[i].isActive == TRUE)
-            count++;
+    while (activeTasks != 0)
+    {
+        activeTasks &= activeTasks - 1;
+        count++;
+    }
 
     return count;
 }
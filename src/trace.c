@@ -0,0 +1,87 @@
+#include "global.h"
+#include "mgba.h"
+#include "trace.h"
+
+#if TRACE_ENABLED
+EWRAM_DATA static struct TraceBuffer sTraceBuffer = {0};
+#endif
+
+#if TRACE_CLOCK_ENABLED
+
+// Timer1 counts every 64 cycles and Timer2 counts its overflows, which
+// gives a 32-bit clock that wraps after about 4.5 hours.
+void TraceInit(void)
+{
+    REG_TM1CNT_H = 0;
+    REG_TM2CNT_H = 0;
+    REG_TM1CNT_L = 0;
+    REG_TM2CNT_L = 0;
+    REG_TM2CNT_H = TIMER_ENABLE | TIMER_COUNTUP;
+    REG_TM1CNT_H = TIMER_ENABLE | TIMER_64CLK;
+
+#if TRACE_ENABLED
+    sTraceBuffer.magic = TRACE_BUFFER_MAGIC;
+    sTraceBuffer.version = TRACE_VERSION;
+    sTraceBuffer.size = TRACE_BUFFER_SIZE;
+    sTraceBuffer.count = 0;
+#endif
+}
+
+u32 GetTraceTimestamp(void)
+{
+    u16 high, low;
+
+    // Read the high half again in case Timer1 overflowed in between.
+    do
+    {
+        high = REG_TM2CNT_L;
+        low = REG_TM1CNT_L;
+    } while (high != REG_TM2CNT_L);
+
+    return ((u32)high << 16) | low;
+}
+
+#endif // TRACE_CLOCK_ENABLED
+
+#if TRACE_ENABLED
+
+// Only called from the main loop, never from interrupts.
+void RecordTraceEvent(u16 id, u8 phase, u8 argCount, u32 arg0, u32 arg1)
+{
+    struct TraceEvent *event = &sTraceBuffer.events[sTraceBuffer.count & (TRACE_BUFFER_SIZE - 1)];
+
+    event->timestamp = GetTraceTimestamp();
+    event->id = id;
+    event->phase = phase;
+    event->argCount = argCount;
+    event->args[0] = arg0;
+    event->args[1] = arg1;
+    sTraceBuffer.count++;
+}
+
+// Writes the buffer out through mGBA's debug log, one event per line, oldest
+// first. Slow, so only meant to be done on request.
+void DumpTraceBuffer(void)
+{
+    u32 i, start;
+
+    if (!mgba_open())
+        return;
+
+    start = 0;
+    if (sTraceBuffer.count > TRACE_BUFFER_SIZE)
+        start = sTraceBuffer.count - TRACE_BUFFER_SIZE;
+
+    mgba_printf(LOGINFO, "TRACE BEGIN %u %u", TRACE_VERSION, sTraceBuffer.count - start);
+    for (i = start; i < sTraceBuffer.count; i++)
+    {
+        struct TraceEvent *event = &sTraceBuffer.events[i & (TRACE_BUFFER_SIZE - 1)];
+
+        mgba_printf(LOGINFO, "TRACE %08X %04X %X %X %08X %08X",
+                    event->timestamp, event->id, event->phase, event->argCount, event->args[0], event->args[1]);
+    }
+    mgba_printf(LOGINFO, "TRACE END");
+    mgba_close();
+}
+
+#endif // TRACE_ENABLED
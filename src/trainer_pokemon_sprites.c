@@ -85,6 +85,21 @@ static bool16 DecompressPic(u16 species, u32 personality, bool8 isFrontPic, u8 *
     return FALSE;
 }
 
+// The sprite is made before the pic is in, so its first frame went to VRAM
+// blank; restarting the anim copies it again.
+static void PicSpriteLoaded(u32 spriteId)
+{
+    StartSpriteAnim(&gSprites[spriteId], gSprites[spriteId].animNum);
+}
+
+static void DecompressMonPicAsync(u16 species, u32 personality, bool8 isFrontPic, u8 *dest, u8 spriteId)
+{
+    if (isFrontPic)
+        LoadSpecialPokePicAsync(&gMonFrontPicTable[species], dest, species, personality, isFrontPic, PicSpriteLoaded, spriteId);
+    else
+        LoadSpecialPokePicAsync(&gMonBackPicTable[species], dest, species, personality, isFrontPic, PicSpriteLoaded, spriteId);
+}
+
 static void LoadPicPaletteByTagOrSlot(u16 species, u32 otId, u32 personality, u8 paletteSlot, u16 paletteTag, bool8 isTrainer)
 {
     if (!isTrainer)
@@ -131,7 +146,7 @@ static void AssignSpriteAnimsTable(bool8 isTrainer)
         sCreatingSpriteTemplate.anims = gTrainerFrontAnimsPtrTable[0];
 }
 
-static u16 CreatePicSprite(u16 species, u32 otId, u32 personality, bool8 isFrontPic, s16 x, s16 y, u8 paletteSlot, u16 paletteTag, bool8 isTrainer)
+static u16 CreatePicSprite(u16 species, u32 otId, u32 personality, bool8 isFrontPic, s16 x, s16 y, u8 paletteSlot, u16 paletteTag, bool8 isTrainer, bool8 async)
 {
     u8 i;
     u8 *framePics;
@@ -150,7 +165,10 @@ static u16 CreatePicSprite(u16 species, u32 otId, u32 personality, bool8 isFront
     {
         return 0xFFFF;
     }
-    framePics = Alloc(4 * 0x800);
+    if (async)
+        framePics = AllocZeroed(4 * 0x800);
+    else
+        framePics = Alloc(4 * 0x800);
     if (!framePics)
     {
         return 0xFFFF;
@@ -161,7 +179,7 @@ static u16 CreatePicSprite(u16 species, u32 otId, u32 personality, bool8 isFront
         Free(framePics);
         return 0xFFFF;
     }
-    if (DecompressPic(species, personality, isFrontPic, framePics, isTrainer))
+    if (!async && DecompressPic(species, personality, isFrontPic, framePics, isTrainer))
     {
         // debug trap?
         return 0xFFFF;
@@ -188,6 +206,8 @@ static u16 CreatePicSprite(u16 species, u32 otId, u32 personality, bool8 isFront
     sSpritePics[i].paletteTag = paletteTag;
     sSpritePics[i].spriteId = spriteId;
     sSpritePics[i].active = TRUE;
+    if (async)
+        DecompressMonPicAsync(species, personality, isFrontPic, framePics, spriteId);
     return spriteId;
 }
 
@@ -298,6 +318,7 @@ static u16 FreeAndDestroyPicSpriteInternal(u16 spriteId)
         FreeSpritePaletteByTag(GetSpritePaletteTagByPaletteNum(gSprites[spriteId].oam.paletteNum));
     }
     DestroySprite(&gSprites[spriteId]);
+    CancelLZDecompressAsyncTo(framePics);
     Free(framePics);
     Free(images);
     sSpritePics[i] = sDummyPicData;
@@ -331,7 +352,14 @@ static u16 CreateTrainerCardSprite(u16 species, u32 otId, u32 personality, bool8
 
 u16 CreateMonPicSprite(u16 species, u32 otId, u32 personality, bool8 isFrontPic, s16 x, s16 y, u8 paletteSlot, u16 paletteTag)
 {
-    return CreatePicSprite(species, otId, personality, isFrontPic, x, y, paletteSlot, paletteTag, FALSE);
+    return CreatePicSprite(species, otId, personality, isFrontPic, x, y, paletteSlot, paletteTag, FALSE, FALSE);
+}
+
+// Like CreateMonPicSprite, but the pic is decompressed over the next frames and
+// the sprite is blank until then. For screens that show several pics at once.
+u16 CreateMonPicSpriteAsync(u16 species, u32 otId, u32 personality, bool8 isFrontPic, s16 x, s16 y, u8 paletteSlot, u16 paletteTag)
+{
+    return CreatePicSprite(species, otId, personality, isFrontPic, x, y, paletteSlot, paletteTag, FALSE, TRUE);
 }
 
 u16 FreeAndDestroyMonPicSprite(u16 spriteId)
@@ -352,7 +380,7 @@ u16 CreateTrainerCardMonIconSprite(u16 species, u32 otId, u32 personality, bool8
 
 u16 CreateTrainerPicSprite(u16 species, bool8 isFrontPic, s16 x, s16 y, u8 paletteSlot, u16 paletteTag)
 {
-    return CreatePicSprite(species, 0, 0, isFrontPic, x, y, paletteSlot, paletteTag, TRUE);
+    return CreatePicSprite(species, 0, 0, isFrontPic, x, y, paletteSlot, paletteTag, TRUE, FALSE);
 }
 
 u16 FreeAndDestroyTrainerPicSprite(u16 spriteId)
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "util.h"
+#include "color_lut.h"
 #include "sprite.h"
 #include "palette.h"
 
@@ -262,17 +263,13 @@ u32 CalcByteArraySum(const u8* data, u32 length)
 
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u16 blendColor)
 {
-    u16 i;
-    for (i = 0; i < numEntries; i++)
+    const u16 *src = &gPlttBufferUnfaded[palOffset];
+    u16 *dest = &gPlttBufferFaded[palOffset];
+
+    SetColorBlend(coeff, blendColor);
+    while (numEntries--)
     {
-        u16 index = i + palOffset;
-        struct PlttData *data1 = (struct PlttData *)&gPlttBufferUnfaded[index];
-        s8 r = data1->r;
-        s8 g = data1->g;
-        s8 b = data1->b;
-        struct PlttData *data2 = (struct PlttData *)&blendColor;
-        gPlttBufferFaded[index] = ((r + (((data2->r - r) * coeff) >> 4)) << 0)
-                                | ((g + (((data2->g - g) * coeff) >> 4)) << 5)
-                                | ((b + (((data2->b - b) * coeff) >> 4)) << 10);
+        u32 color = *src++;
+        *dest++ = BLEND_COLOR(color & 0x1F, (color >> 5) & 0x1F, (color >> 10) & 0x1F);
     }
 }
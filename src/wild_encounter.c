@@ -52,6 +52,14 @@ EWRAM_DATA bool8 gIsFishingEncounter = 0;
 EWRAM_DATA bool8 gIsSurfingEncounter = 0;
 EWRAM_DATA static u32 sFeebasRngValue = 0;
 
+// First gWildMonHeaders index for every map, with maps numbered
+// consecutively as in MAP_GROUP_OFFSETS. Built on first use, since the
+// headers never change at runtime.
+EWRAM_DATA static u16 sWildMonHeaderIdsByMap[MAPS_COUNT] = {0};
+EWRAM_DATA static bool8 sWildMonHeaderIdsBuilt = FALSE;
+
+static const u16 sMapGroupOffsets[MAP_GROUPS_COUNT] = MAP_GROUP_OFFSETS;
+
 #include "data/wild_encounters.h"
 
 //Special Feebas-related data.
@@ -244,34 +252,76 @@ static u8 ChooseWildMonIndex_Fishing(u8 rod)
     return wildMonIndex;
 }
 
-u16 GetCurrentMapWildMonHeaderId(void)
+// Returns the index of a map in sWildMonHeaderIdsByMap, or MAPS_COUNT if
+// the map doesn't exist.
+static u16 GetWildMonHeaderMapIndex(u8 mapGroup, u8 mapNum)
+{
+    u16 groupSize;
+
+    if (mapGroup >= MAP_GROUPS_COUNT)
+        return MAPS_COUNT;
+
+    if (mapGroup == MAP_GROUPS_COUNT - 1)
+        groupSize = MAPS_COUNT - sMapGroupOffsets[mapGroup];
+    else
+        groupSize = sMapGroupOffsets[mapGroup + 1] - sMapGroupOffsets[mapGroup];
+
+    if (mapNum >= groupSize)
+        return MAPS_COUNT;
+
+    return sMapGroupOffsets[mapGroup] + mapNum;
+}
+
+static void BuildWildMonHeaderIdsByMap(void)
 {
     u16 i;
+    u16 mapIndex;
+    u16 headerCount;
 
-    for (i = 0; ; i++)
+    for (i = 0; i < MAPS_COUNT; i++)
+        sWildMonHeaderIdsByMap[i] = 0xFFFF;
+
+    for (headerCount = 0; gWildMonHeaders[headerCount].mapGroup != 0xFF; headerCount++)
+        ;
+
+    // Go backwards so a map with several headers keeps its first one.
+    for (i = headerCount; i != 0; i--)
     {
-        const struct WildPokemonHeader *wildHeader = &gWildMonHeaders[i];
-        if (wildHeader->mapGroup == 0xFF)
-            break;
+        mapIndex = GetWildMonHeaderMapIndex(gWildMonHeaders[i - 1].mapGroup, gWildMonHeaders[i - 1].mapNum);
+        if (mapIndex != MAPS_COUNT)
+            sWildMonHeaderIdsByMap[mapIndex] = i - 1;
+    }
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId > 8)
-                    alteringCaveId = 0;
+    sWildMonHeaderIdsBuilt = TRUE;
+}
 
-                i += alteringCaveId;
-            }
+u16 GetCurrentMapWildMonHeaderId(void)
+{
+    u16 i;
+    u16 mapIndex;
 
-            return i;
-        }
+    if (!sWildMonHeaderIdsBuilt)
+        BuildWildMonHeaderIdsByMap();
+
+    mapIndex = GetWildMonHeaderMapIndex(gSaveBlock1Ptr->location.mapGroup, gSaveBlock1Ptr->location.mapNum);
+    if (mapIndex == MAPS_COUNT)
+        return -1;
+
+    i = sWildMonHeaderIdsByMap[mapIndex];
+    if (i == 0xFFFF)
+        return -1;
+
+    if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(ALTERING_CAVE) &&
+        gSaveBlock1Ptr->location.mapNum == MAP_NUM(ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId > 8)
+            alteringCaveId = 0;
+
+        i += alteringCaveId;
     }
 
-    return -1;
+    return i;
 }
 
 static u8 PickWildMonNature(void)
@@ -0,0 +1,464 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include <sys/stat.h>
+#include "animcheck.h"
+#include "anim_gfx.h"
+
+typedef std::map<std::string, std::string> DefineMap;
+
+static std::string ReadWholeFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("Error: Cannot open file \"%s\" for reading.\n", path.c_str());
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static std::string StripComments(const std::string &text)
+{
+    std::string result;
+    std::size_t i = 0;
+
+    while (i < text.size())
+    {
+        if (text.compare(i, 2, "//") == 0)
+        {
+            i = text.find('\n', i);
+            if (i == std::string::npos)
+                break;
+        }
+        else if (text.compare(i, 2, "/*") == 0)
+        {
+            i = text.find("*/", i + 2);
+            if (i == std::string::npos)
+                break;
+            i += 2;
+            result += ' ';
+        }
+        else
+        {
+            result += text[i++];
+        }
+    }
+    return result;
+}
+
+static DefineMap ReadDefines(const std::string &path)
+{
+    static const std::regex defineRegex("\\s*#\\s*define\\s+(\\w+)\\s+(.*?)\\s*");
+    std::istringstream stream(StripComments(ReadWholeFile(path)));
+    std::string line;
+    std::smatch match;
+    DefineMap defines;
+
+    while (std::getline(stream, line))
+    {
+        if (std::regex_match(line, match, defineRegex))
+            defines[match[1]] = match[2];
+    }
+    return defines;
+}
+
+// Enough of C's integer expressions for constant headers: numbers, other
+// defines, parentheses and the usual arithmetic and bitwise operators.
+class ExpressionParser
+{
+public:
+    ExpressionParser(const std::string &text, const DefineMap &defines, int depth)
+        : m_text(text), m_pos(0), m_defines(defines), m_depth(depth), m_ok(true) {}
+
+    bool Evaluate(long &value)
+    {
+        value = ParseOr();
+        SkipSpace();
+        return m_ok && m_pos == m_text.size();
+    }
+
+private:
+    void SkipSpace()
+    {
+        while (m_pos < m_text.size() && std::isspace((unsigned char)m_text[m_pos]))
+            m_pos++;
+    }
+
+    bool Accept(const char *op)
+    {
+        SkipSpace();
+        if (m_text.compare(m_pos, std::strlen(op), op) != 0)
+            return false;
+        m_pos += std::strlen(op);
+        return true;
+    }
+
+    long ParseOr()
+    {
+        long value = ParseAnd();
+        while (Accept("|"))
+            value |= ParseAnd();
+        return value;
+    }
+
+    long ParseAnd()
+    {
+        long value = ParseShift();
+        while (Accept("&"))
+            value &= ParseShift();
+        return value;
+    }
+
+    long ParseShift()
+    {
+        long value = ParseAdd();
+        for (;;)
+        {
+            if (Accept("<<"))
+                value <<= ParseAdd();
+            else if (Accept(">>"))
+                value >>= ParseAdd();
+            else
+                return value;
+        }
+    }
+
+    long ParseAdd()
+    {
+        long value = ParseMul();
+        for (;;)
+        {
+            if (Accept("+"))
+                value += ParseMul();
+            else if (Accept("-"))
+                value -= ParseMul();
+            else
+                return value;
+        }
+    }
+
+    long ParseMul()
+    {
+        long value = ParseUnary();
+        for (;;)
+        {
+            if (Accept("*"))
+            {
+                value *= ParseUnary();
+            }
+            else if (Accept("/"))
+            {
+                long divisor = ParseUnary();
+                if (divisor == 0)
+                    m_ok = false;
+                else
+                    value /= divisor;
+            }
+            else
+            {
+                return value;
+            }
+        }
+    }
+
+    long ParseUnary()
+    {
+        if (Accept("-"))
+            return -ParseUnary();
+        if (Accept("~"))
+            return ~ParseUnary();
+        return ParsePrimary();
+    }
+
+    long ParsePrimary()
+    {
+        SkipSpace();
+        if (Accept("("))
+        {
+            long value = ParseOr();
+            if (!Accept(")"))
+                m_ok = false;
+            return value;
+        }
+
+        std::size_t start = m_pos;
+        while (m_pos < m_text.size() && (std::isalnum((unsigned char)m_text[m_pos]) || m_text[m_pos] == '_'))
+            m_pos++;
+        std::string token = m_text.substr(start, m_pos - start);
+
+        if (token.empty())
+        {
+            m_ok = false;
+            return 0;
+        }
+        if (std::isdigit((unsigned char)token[0]))
+            return std::strtol(token.c_str(), nullptr, 0);
+
+        auto it = m_defines.find(token);
+        long value = 0;
+        if (it == m_defines.end() || m_depth > 16
+         || !ExpressionParser(it->second, m_defines, m_depth + 1).Evaluate(value))
+            m_ok = false;
+        return value;
+    }
+
+    const std::string &m_text;
+    std::size_t m_pos;
+    const DefineMap &m_defines;
+    int m_depth;
+    bool m_ok;
+};
+
+static unsigned GetDefineValue(const std::string &path, const std::string &name)
+{
+    DefineMap defines = ReadDefines(path);
+    auto it = defines.find(name);
+    long value;
+
+    if (it == defines.end() || !ExpressionParser(it->second, defines, 0).Evaluate(value))
+        FATAL_ERROR("Error: Cannot find the value of %s in \"%s\".\n", name.c_str(), path.c_str());
+    return value;
+}
+
+// Sheets under #if appear more than once; the larger one counts.
+static void ReadPicTable(const std::string &path, AnimGfxData &gfx)
+{
+    static const std::regex entryRegex("\\{\\s*\\w+\\s*,\\s*(\\w+)\\s*,\\s*(\\w+)\\s*\\}");
+    std::string text = StripComments(ReadWholeFile(path));
+    std::size_t start = text.find("gBattleAnimPicTable[] =");
+
+    if (start == std::string::npos)
+        FATAL_ERROR("Error: No gBattleAnimPicTable in \"%s\".\n", path.c_str());
+
+    std::string table = text.substr(start, text.find("};", start) - start);
+
+    for (auto it = std::sregex_iterator(table.begin(), table.end(), entryRegex); it != std::sregex_iterator(); ++it)
+    {
+        unsigned &size = gfx.sheetSizes[(*it)[2]];
+        size = std::max(size, (unsigned)std::strtoul((*it)[1].str().c_str(), nullptr, 0));
+    }
+}
+
+static std::string Trim(const std::string &text)
+{
+    std::size_t first = text.find_first_not_of(" \t\r\n");
+    std::size_t last = text.find_last_not_of(" \t\r\n");
+
+    if (first == std::string::npos)
+        return "";
+    return text.substr(first, last - first + 1);
+}
+
+static std::vector<std::string> SplitInitializer(const std::string &body)
+{
+    std::vector<std::string> fields;
+    std::string current;
+    int depth = 0;
+
+    for (char c : body)
+    {
+        if (c == '(' || c == '{')
+            depth++;
+        else if (c == ')' || c == '}')
+            depth--;
+
+        if (c == ',' && depth == 0)
+        {
+            fields.push_back(Trim(current));
+            current.clear();
+        }
+        else
+        {
+            current += c;
+        }
+    }
+    if (!Trim(current).empty())
+        fields.push_back(Trim(current));
+    return fields;
+}
+
+static bool IsNoneTag(const std::string &tag)
+{
+    return tag == "TAG_NONE" || tag == "0xFFFF" || tag == "0xffff" || tag == "65535";
+}
+
+// START is just past an opening brace; returns the position just past its match.
+static std::size_t FindClosingBrace(const std::string &text, std::size_t start)
+{
+    std::size_t end = start;
+    int depth = 1;
+
+    while (end < text.size() && depth > 0)
+    {
+        if (text[end] == '{')
+            depth++;
+        else if (text[end] == '}')
+            depth--;
+        end++;
+    }
+    return end;
+}
+
+static void ReadTemplates(const std::string &path, AnimGfxData &gfx)
+{
+    static const std::regex templateRegex("struct\\s+SpriteTemplate\\s+(\\w+)\\s*=\\s*\\{");
+    static const std::regex oamSizeRegex("(\\d+)x(\\d+)$");
+    std::string raw = ReadWholeFile(path);
+
+    if (raw.find("SpriteTemplate") == std::string::npos)
+        return;
+
+    std::string text = StripComments(raw);
+
+    for (auto it = std::sregex_iterator(text.begin(), text.end(), templateRegex); it != std::sregex_iterator(); ++it)
+    {
+        std::size_t start = it->position() + it->length();
+        std::size_t end = FindClosingBrace(text, start);
+
+        // Drop preprocessor lines; a template either way has the same tags.
+        std::string body;
+        std::istringstream lines(text.substr(start, end - 1 - start));
+        std::string line;
+        while (std::getline(lines, line))
+        {
+            if (Trim(line)[0] != '#')
+                body += line + "\n";
+        }
+
+        std::vector<std::string> fields = SplitInitializer(body);
+        std::string tileTag, paletteTag, oam;
+
+        if (body.find(".tileTag") != std::string::npos)
+        {
+            for (const std::string &field : fields)
+            {
+                std::size_t equals = field.find('=');
+                std::string name = Trim(field.substr(0, equals));
+                std::string value = equals == std::string::npos ? "" : Trim(field.substr(equals + 1));
+
+                if (name == ".tileTag")
+                    tileTag = value;
+                else if (name == ".paletteTag")
+                    paletteTag = value;
+                else if (name == ".oam")
+                    oam = value;
+            }
+        }
+        else if (fields.size() >= 3)
+        {
+            tileTag = fields[0];
+            paletteTag = fields[1];
+            oam = fields[2];
+        }
+
+        AnimSpriteTemplate spriteTemplate;
+        std::smatch match;
+
+        spriteTemplate.tileTag = IsNoneTag(tileTag) ? "" : tileTag;
+        spriteTemplate.paletteTag = IsNoneTag(paletteTag) ? "" : paletteTag;
+        spriteTemplate.tiles = 0;
+        if (spriteTemplate.tileTag.empty() && std::regex_search(oam, match, oamSizeRegex))
+            spriteTemplate.tiles = std::stoul(match[1]) * std::stoul(match[2]) / 64;
+        gfx.templates[(*it)[1]] = spriteTemplate;
+    }
+}
+
+// Visual tasks that load or free one of the script's sheets themselves, like
+// AnimTask_LoadPokeblockGfx. A createvisualtask runs its task right away, so
+// the sheet is there for the next command.
+static void ReadTaskSheets(const std::string &path, AnimGfxData &gfx)
+{
+    static const std::regex taskRegex("void\\s+(AnimTask_\\w+)\\s*\\(\\s*u8\\s+\\w+\\s*\\)\\s*\\{");
+    static const std::regex loadRegex("LoadCompressedSpriteSheet\\w*\\s*\\(\\s*&\\s*gBattleAnimPicTable\\s*\\[[^\\]]*?(ANIM_TAG_\\w+)");
+    static const std::regex freeRegex("FreeSpriteTilesByTag\\s*\\(\\s*(ANIM_TAG_\\w+)\\s*\\)");
+    std::string raw = ReadWholeFile(path);
+
+    if (raw.find("AnimTask_") == std::string::npos)
+        return;
+
+    std::string text = StripComments(raw);
+
+    for (auto it = std::sregex_iterator(text.begin(), text.end(), taskRegex); it != std::sregex_iterator(); ++it)
+    {
+        std::size_t start = it->position() + it->length();
+        std::string body = text.substr(start, FindClosingBrace(text, start) - start);
+
+        for (auto load = std::sregex_iterator(body.begin(), body.end(), loadRegex); load != std::sregex_iterator(); ++load)
+            gfx.taskLoads[(*it)[1]].push_back((*load)[1]);
+        for (auto unload = std::sregex_iterator(body.begin(), body.end(), freeRegex); unload != std::sregex_iterator(); ++unload)
+            gfx.taskFrees[(*it)[1]].push_back((*unload)[1]);
+    }
+}
+
+static void ScanDirectory(const std::string &dirPath, AnimGfxData &gfx)
+{
+    DIR *dir = opendir(dirPath.c_str());
+    struct dirent *entry;
+
+    if (dir == nullptr)
+        return;
+
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        std::string name = entry->d_name;
+        std::string path = dirPath + "/" + name;
+        std::size_t dot = name.rfind('.');
+        std::string extension = dot == std::string::npos ? "" : name.substr(dot);
+        struct stat st;
+
+        if (name[0] == '.' || stat(path.c_str(), &st) != 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+            ScanDirectory(path, gfx);
+        else if (extension == ".c" || extension == ".h")
+        {
+            ReadTemplates(path, gfx);
+            if (extension == ".c")
+                ReadTaskSheets(path, gfx);
+        }
+    }
+    closedir(dir);
+}
+
+AnimGfxData ReadAnimGfxData(const std::string &root)
+{
+    AnimGfxData gfx;
+    DefineMap animConstants = ReadDefines(root + "/include/constants/battle_anim.h");
+
+    for (const auto &define : animConstants)
+    {
+        long value;
+
+        if (define.first.compare(0, 9, "ANIM_TAG_") == 0
+         && ExpressionParser(define.second, animConstants, 0).Evaluate(value))
+            gfx.tagNames[value] = define.first;
+    }
+
+    ReadPicTable(root + "/src/battle_anim.c", gfx);
+    ScanDirectory(root + "/src", gfx);
+    gfx.maxSprites = GetDefineValue(root + "/gflib/sprite.h", "MAX_SPRITES");
+    gfx.numTasks = GetDefineValue(root + "/include/task.h", "NUM_TASKS");
+    gfx.maxAnimSheets = GetDefineValue(root + "/src/battle_anim.c", "ANIM_SPRITE_INDEX_COUNT");
+    return gfx;
+}
+
+std::string GetTagName(const AnimGfxData &gfx, const std::string &tag)
+{
+    char *end;
+    long value;
+
+    if (tag.empty() || !std::isdigit((unsigned char)tag[0]))
+        return tag;
+
+    value = std::strtol(tag.c_str(), &end, 0);
+    auto it = gfx.tagNames.find(value);
+    if (*end != '\0' || it == gfx.tagNames.end())
+        return tag;
+    return it->second;
+}
@@ -0,0 +1,34 @@
+#ifndef ANIM_GFX_H
+#define ANIM_GFX_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+struct AnimSpriteTemplate
+{
+    std::string tileTag;
+    std::string paletteTag;
+    unsigned tiles; // allocated per sprite when tileTag is TAG_NONE, from the OamData name
+};
+
+// What the scripts refer to, read from the C sources.
+struct AnimGfxData
+{
+    std::map<std::string, unsigned> sheetSizes; // gBattleAnimPicTable size in bytes, by tag name
+    std::map<long, std::string> tagNames;       // ANIM_TAG_* values, for tags given as numbers
+    std::map<std::string, AnimSpriteTemplate> templates;
+    std::map<std::string, std::vector<std::string>> taskLoads; // sheets a visual task loads, by task name
+    std::map<std::string, std::vector<std::string>> taskFrees; // and those it frees
+    unsigned maxSprites;    // MAX_SPRITES
+    unsigned numTasks;      // NUM_TASKS
+    unsigned maxAnimSheets; // ANIM_SPRITE_INDEX_COUNT, sheets freed by the end command
+};
+
+// ROOT is the top of the repository.
+AnimGfxData ReadAnimGfxData(const std::string &root);
+
+// Gives the ANIM_TAG_* name for a tag written either way.
+std::string GetTagName(const AnimGfxData &gfx, const std::string &tag);
+
+#endif // ANIM_GFX_H
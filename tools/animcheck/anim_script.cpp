@@ -0,0 +1,393 @@
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include "animcheck.h"
+#include "anim_script.h"
+
+struct Macro
+{
+    std::vector<std::string> params;
+    bool vararg;
+    std::vector<std::string> body;
+    bool isCommand;         // body starts with .byte OPCODE
+    unsigned opcode;
+    std::vector<std::size_t> pointerParams; // params stored with .4byte or .word
+};
+
+typedef std::map<std::string, Macro> MacroMap;
+
+static std::string ReadWholeFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("Error: Cannot open file \"%s\" for reading.\n", path.c_str());
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Blanks out //, /* */ and @ comments, keeping the line breaks so line
+// numbers still match. \@ in a macro body is a label counter, not a comment.
+static std::string StripComments(const std::string &text)
+{
+    std::string result = text;
+    std::size_t i = 0;
+
+    while (i < result.size())
+    {
+        std::size_t end;
+
+        if (result.compare(i, 2, "//") == 0 || (result[i] == '@' && (i == 0 || result[i - 1] != '\\')))
+        {
+            end = result.find('\n', i);
+            if (end == std::string::npos)
+                end = result.size();
+        }
+        else if (result.compare(i, 2, "/*") == 0)
+        {
+            end = result.find("*/", i + 2);
+            end = end == std::string::npos ? result.size() : end + 2;
+        }
+        else
+        {
+            i++;
+            continue;
+        }
+
+        for (; i < end; i++)
+        {
+            if (result[i] != '\n')
+                result[i] = ' ';
+        }
+    }
+    return result;
+}
+
+static std::string Trim(const std::string &text)
+{
+    std::size_t first = text.find_first_not_of(" \t\r");
+    std::size_t last = text.find_last_not_of(" \t\r");
+
+    if (first == std::string::npos)
+        return "";
+    return text.substr(first, last - first + 1);
+}
+
+static bool IsOperator(char c)
+{
+    return c != '\0' && std::strchr("+-*/%|&^~<>!=(", c) != nullptr;
+}
+
+// Macro arguments are separated by commas, spaces or both, as in gas. Spaces
+// next to an operator are part of an expression instead.
+static std::vector<std::string> SplitArgs(const std::string &text)
+{
+    std::vector<std::string> args;
+    std::string current;
+    int depth = 0;
+    bool commas = text.find(',') != std::string::npos;
+
+    for (std::size_t i = 0; i < text.size(); i++)
+    {
+        char c = text[i];
+
+        if (c == '(')
+            depth++;
+        else if (c == ')')
+            depth--;
+
+        if (depth == 0 && c == ',')
+        {
+            args.push_back(Trim(current));
+            current.clear();
+        }
+        else if (depth == 0 && (c == ' ' || c == '\t'))
+        {
+            std::string before = Trim(current);
+            std::size_t next = text.find_first_not_of(" \t", i);
+            char after = next == std::string::npos ? '\0' : text[next];
+
+            if (!before.empty() && after != '\0' && after != ','
+             && !IsOperator(before.back()) && (!IsOperator(after) || after == '('))
+            {
+                args.push_back(before);
+                current.clear();
+            }
+            else
+            {
+                current += c;
+            }
+        }
+        else
+        {
+            current += c;
+        }
+    }
+    if (!Trim(current).empty() || (commas && !args.empty()))
+        args.push_back(Trim(current));
+    return args;
+}
+
+static bool ParseNumber(const std::string &text, unsigned &value)
+{
+    char *end;
+
+    if (text.empty() || !std::isdigit((unsigned char)text[0]))
+        return false;
+    value = std::strtoul(text.c_str(), &end, 0);
+    return *end == '\0';
+}
+
+static void SplitStatement(const std::string &line, std::string &name, std::string &rest)
+{
+    std::string text = Trim(line);
+    std::size_t space = text.find_first_of(" \t");
+
+    name = text.substr(0, space);
+    rest = space == std::string::npos ? "" : Trim(text.substr(space));
+}
+
+static MacroMap ReadMacros(const std::string &path)
+{
+    std::istringstream stream(StripComments(ReadWholeFile(path)));
+    std::string line;
+    MacroMap macros;
+    Macro *macro = nullptr;
+
+    while (std::getline(stream, line))
+    {
+        std::string name, rest;
+
+        SplitStatement(line, name, rest);
+        if (name == ".macro")
+        {
+            std::string macroName, paramText;
+
+            SplitStatement(rest, macroName, paramText);
+
+            Macro &newMacro = macros[macroName];
+
+            newMacro = Macro();
+            newMacro.vararg = false;
+            newMacro.isCommand = false;
+            newMacro.opcode = 0;
+            for (std::string param : SplitArgs(paramText))
+            {
+                std::size_t colon = param.find_first_of(":=");
+
+                if (param.compare(colon == std::string::npos ? param.size() : colon, 7, ":vararg") == 0)
+                    newMacro.vararg = true;
+                newMacro.params.push_back(param.substr(0, colon));
+            }
+            macro = &newMacro;
+        }
+        else if (name == ".endm")
+        {
+            macro = nullptr;
+        }
+        else if (macro != nullptr && !name.empty())
+        {
+            if (macro->body.empty() && name == ".byte")
+                macro->isCommand = ParseNumber(rest, macro->opcode);
+            if (macro->isCommand && (name == ".4byte" || name == ".word") && rest[0] == '\\')
+            {
+                auto it = std::find(macro->params.begin(), macro->params.end(), rest.substr(1));
+
+                if (it != macro->params.end())
+                    macro->pointerParams.push_back(it - macro->params.begin());
+            }
+            macro->body.push_back(Trim(line));
+        }
+    }
+    return macros;
+}
+
+std::vector<std::string> ReadCommandTable(const std::string &path)
+{
+    std::string text = StripComments(ReadWholeFile(path));
+    std::size_t start = text.find("sScriptCmdTable[])(void) =");
+    std::vector<std::string> names;
+
+    if (start == std::string::npos)
+        FATAL_ERROR("Error: No sScriptCmdTable in \"%s\".\n", path.c_str());
+
+    std::size_t end = text.find("};", start);
+    std::string table = text.substr(start, end - start);
+    std::regex entryRegex("ScriptCmd_(\\w+)");
+
+    for (auto it = std::sregex_iterator(table.begin(), table.end(), entryRegex); it != std::sregex_iterator(); ++it)
+        names.push_back((*it)[1]);
+    return names;
+}
+
+class ScriptReader
+{
+public:
+    ScriptReader(AnimScriptFile &file, const MacroMap &macros, const std::vector<std::string> &commandNames)
+        : m_file(file), m_macros(macros), m_commandNames(commandNames) {}
+
+    void ReadLine(const std::string &line, unsigned lineNum);
+
+private:
+    void ReadStatement(const std::string &statement, unsigned lineNum, int depth);
+    void ExpandMacro(const std::string &name, const Macro &macro, const std::vector<std::string> &args,
+                     unsigned lineNum, int depth);
+
+    AnimScriptFile &m_file;
+    const MacroMap &m_macros;
+    const std::vector<std::string> &m_commandNames;
+    std::string m_tableName; // the label .4byte entries are listed under
+};
+
+// A line can hold several statements separated by semicolons, and each can
+// start with a label.
+void ScriptReader::ReadLine(const std::string &line, unsigned lineNum)
+{
+    static const std::regex labelRegex("^\\s*([A-Za-z_.$][\\w.$]*)\\s*::?(.*)$");
+    std::istringstream stream(line);
+    std::string statement;
+
+    if (Trim(line)[0] == '#')
+        return;
+
+    while (std::getline(stream, statement, ';'))
+    {
+        std::smatch match;
+
+        if (std::regex_match(statement, match, labelRegex))
+        {
+            std::string label = match[1];
+
+            if (m_file.labels.count(label))
+                FATAL_ERROR("%s:%u: label \"%s\" is defined twice\n", m_file.path.c_str(), lineNum, label.c_str());
+            m_file.labels[label] = m_file.commands.size();
+            m_tableName = label;
+            statement = match[2];
+        }
+
+        if (!Trim(statement).empty())
+            ReadStatement(statement, lineNum, 0);
+    }
+}
+
+void ScriptReader::ReadStatement(const std::string &statement, unsigned lineNum, int depth)
+{
+    std::string name, rest;
+
+    SplitStatement(statement, name, rest);
+    if (name[0] == '.')
+    {
+        static const char *const dataDirectives[] = {".byte", ".2byte", ".hword", ".4byte", ".word"};
+        AnimCommand command;
+
+        if (std::find(std::begin(dataDirectives), std::end(dataDirectives), name) == std::end(dataDirectives))
+            return;
+
+        command.isData = true;
+        command.opcode = 0;
+        command.line = lineNum;
+        m_file.commands.push_back(command);
+        if ((name == ".4byte" || name == ".word") && !m_tableName.empty())
+        {
+            std::vector<std::string> &table = m_file.tables[m_tableName];
+
+            if (table.empty())
+                m_file.tableOrder.push_back(m_tableName);
+            for (const std::string &entry : SplitArgs(rest))
+                table.push_back(entry);
+        }
+        return;
+    }
+
+    auto it = m_macros.find(name);
+
+    if (it == m_macros.end())
+        FATAL_ERROR("%s:%u: unknown command \"%s\"\n", m_file.path.c_str(), lineNum, name.c_str());
+    if (depth > 16)
+        FATAL_ERROR("%s:%u: macro \"%s\" nests too deeply\n", m_file.path.c_str(), lineNum, name.c_str());
+
+    ExpandMacro(name, it->second, SplitArgs(rest), lineNum, depth);
+}
+
+void ScriptReader::ExpandMacro(const std::string &name, const Macro &macro, const std::vector<std::string> &args,
+                               unsigned lineNum, int depth)
+{
+    std::vector<std::string> values = args;
+
+    // The last parameter of a vararg macro takes everything left over.
+    if (macro.vararg && values.size() > macro.params.size())
+    {
+        std::string rest;
+
+        for (std::size_t i = macro.params.size() - 1; i < values.size(); i++)
+            rest += (rest.empty() ? "" : ", ") + values[i];
+        values.resize(macro.params.size() - 1);
+        values.push_back(rest);
+    }
+    values.resize(std::max(values.size(), macro.params.size()));
+
+    if (macro.isCommand)
+    {
+        AnimCommand command;
+
+        if (macro.opcode >= m_commandNames.size())
+            FATAL_ERROR("%s:%u: \"%s\" has opcode 0x%X, which is not in sScriptCmdTable\n",
+                        m_file.path.c_str(), lineNum, name.c_str(), macro.opcode);
+
+        command.isData = false;
+        command.opcode = macro.opcode;
+        command.name = m_commandNames[macro.opcode];
+        command.args = values;
+        command.line = lineNum;
+        for (std::size_t param : macro.pointerParams)
+            command.pointers.push_back(values[param]);
+        m_file.commands.push_back(command);
+        m_tableName.clear();
+        return;
+    }
+
+    // Otherwise the macro is made of other macros. Longer names go first so
+    // \param0 isn't taken for \param followed by 0.
+    std::vector<std::size_t> order(macro.params.size());
+
+    for (std::size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return macro.params[a].size() > macro.params[b].size();
+    });
+
+    for (const std::string &bodyLine : macro.body)
+    {
+        std::string line = bodyLine;
+
+        for (std::size_t i : order)
+        {
+            std::string param = "\\" + macro.params[i];
+            std::size_t pos;
+
+            while ((pos = line.find(param)) != std::string::npos)
+                line.replace(pos, param.size(), values[i]);
+        }
+        ReadStatement(line, lineNum, depth + 1);
+    }
+}
+
+AnimScriptFile ReadAnimScripts(const std::string &path, const std::string &macroPath,
+                               const std::vector<std::string> &commandNames)
+{
+    AnimScriptFile file;
+    MacroMap macros = ReadMacros(macroPath);
+    ScriptReader reader(file, macros, commandNames);
+    std::istringstream stream(StripComments(ReadWholeFile(path)));
+    std::string line;
+    unsigned lineNum = 0;
+
+    file.path = path;
+    while (std::getline(stream, line))
+        reader.ReadLine(line, ++lineNum);
+    return file;
+}
@@ -0,0 +1,39 @@
+#ifndef ANIM_SCRIPT_H
+#define ANIM_SCRIPT_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+// One command of a battle animation script, after macros are expanded. Data
+// directives are kept as commands too, so a script that runs into a table
+// can be told apart from one that ends.
+struct AnimCommand
+{
+    bool isData;
+    unsigned opcode;
+    std::string name;                  // handler in sScriptCmdTable, without ScriptCmd_
+    std::vector<std::string> args;     // in the macro's parameter order
+    std::vector<std::string> pointers; // arguments stored as .4byte: templates, tasks, branch targets
+    unsigned line;
+};
+
+struct AnimScriptFile
+{
+    std::string path;
+    std::vector<AnimCommand> commands;
+    std::map<std::string, std::size_t> labels; // label -> index of the command after it
+    std::map<std::string, std::vector<std::string>> tables; // .4byte lists under each label
+    std::vector<std::string> tableOrder;
+};
+
+// The handler names of sScriptCmdTable in src/battle_anim.c, by opcode.
+std::vector<std::string> ReadCommandTable(const std::string &path);
+
+// Reads a script file such as data/battle_anim_scripts.s, expanding the
+// macros in MACRO_PATH. Every command macro's opcode must be in the command
+// table.
+AnimScriptFile ReadAnimScripts(const std::string &path, const std::string &macroPath,
+                               const std::vector<std::string> &commandNames);
+
+#endif // ANIM_SCRIPT_H
@@ -0,0 +1,136 @@
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+#include "animcheck.h"
+#include "anim_gfx.h"
+#include "anim_script.h"
+#include "script_analysis.h"
+
+static const char *const sResourceNames[RESOURCE_COUNT] = {"sprites", "tasks", "palettes", "tiles"};
+
+// What a double battle holds before any animation runs: four battlers, their
+// healthboxes and healthbars, and the palettes reserved for them.
+static unsigned s_baseline[RESOURCE_COUNT] = {16, 2, 6, 548};
+static bool s_listAll = false;
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: animcheck [-a] [-s SPRITES] [-t TASKS] [-p PALETTES] [-g TILES] [SCRIPT]\n"
+        "\n"
+        "Follows every battle animation listed in the gBattleAnims_* tables of\n"
+        "SCRIPT (default data/battle_anim_scripts.s) and reports scripts that can\n"
+        "run out of sprites, tasks, OBJ palettes or OBJ tiles, use graphics that\n"
+        "aren't loaded, leak sheets, or never reach end. Run from the repo root.\n"
+        "\n"
+        "  -a           list the peak usage of every script\n"
+        "  -s SPRITES   sprites in use before the script starts (default %u)\n"
+        "  -t TASKS     tasks in use before the script starts (default %u)\n"
+        "  -p PALETTES  OBJ palettes in use before the script starts (default %u)\n"
+        "  -g TILES     OBJ tiles in use before the script starts (default %u)\n",
+        s_baseline[RESOURCE_SPRITES], s_baseline[RESOURCE_TASKS],
+        s_baseline[RESOURCE_PALETTES], s_baseline[RESOURCE_TILES]);
+    std::exit(1);
+}
+
+// Each script is checked once, even if several moves share it.
+static std::vector<std::string> GetRootScripts(const AnimScriptFile &file)
+{
+    std::vector<std::string> roots;
+    std::set<std::string> seen;
+
+    for (const std::string &tableName : file.tableOrder)
+    {
+        if (tableName.compare(0, 13, "gBattleAnims_") != 0)
+            continue;
+        for (const std::string &entry : file.tables.at(tableName))
+        {
+            if (!std::isdigit((unsigned char)entry[0]) && seen.insert(entry).second)
+                roots.push_back(entry);
+        }
+    }
+    return roots;
+}
+
+// Going over a limit for certain is an error. Going over only if earlier
+// sprites and tasks are still running is a warning.
+static void AddLimitProblems(ScriptReport &report, const unsigned limits[RESOURCE_COUNT])
+{
+    for (int i = 0; i < RESOURCE_COUNT; i++)
+    {
+        std::string limit = " " + std::string(sResourceNames[i]) + " (limit " + std::to_string(limits[i]) + ")";
+
+        if (report.certainPeak[i] > limits[i])
+            report.problems.push_back({true, report.certainPeakLine[i],
+                "uses " + std::to_string(report.certainPeak[i]) + limit});
+        else if (report.peak[i] > limits[i])
+            report.problems.push_back({false, report.peakLine[i],
+                "can use up to " + std::to_string(report.peak[i]) + limit + " if nothing finishes early"});
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *scriptPath = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-a") == 0)
+            s_listAll = true;
+        else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+            s_baseline[RESOURCE_SPRITES] = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            s_baseline[RESOURCE_TASKS] = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+            s_baseline[RESOURCE_PALETTES] = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-g") == 0 && i + 1 < argc)
+            s_baseline[RESOURCE_TILES] = std::atoi(argv[++i]);
+        else if (scriptPath == nullptr && argv[i][0] != '-')
+            scriptPath = argv[i];
+        else
+            PrintUsage();
+    }
+
+    if (scriptPath == nullptr)
+        scriptPath = "data/battle_anim_scripts.s";
+
+    std::vector<std::string> commandNames = ReadCommandTable("src/battle_anim.c");
+    AnimScriptFile file = ReadAnimScripts(scriptPath, "asm/macros/battle_anim_script.inc", commandNames);
+    AnimGfxData gfx = ReadAnimGfxData(".");
+    unsigned limits[RESOURCE_COUNT];
+    unsigned errorCount = 0, warningCount = 0;
+    std::vector<std::string> roots = GetRootScripts(file);
+
+    if (roots.empty())
+        FATAL_ERROR("Error: No gBattleAnims_* tables in \"%s\".\n", scriptPath);
+
+    GetResourceLimits(gfx, limits);
+    if (s_listAll)
+        std::printf("%-40s %8s %6s %9s %6s\n", "script", "sprites", "tasks", "palettes", "tiles");
+
+    for (const std::string &root : roots)
+    {
+        ScriptReport report = AnalyzeScript(file, gfx, root, s_baseline);
+
+        AddLimitProblems(report, limits);
+        if (s_listAll)
+            std::printf("%-40s %8u %6u %9u %6u\n", root.c_str(), report.peak[RESOURCE_SPRITES],
+                        report.peak[RESOURCE_TASKS], report.peak[RESOURCE_PALETTES], report.peak[RESOURCE_TILES]);
+
+        for (const ScriptProblem &problem : report.problems)
+        {
+            std::fprintf(stderr, "%s:%u: %s: %s: %s\n", scriptPath, problem.line,
+                         problem.isError ? "error" : "warning", root.c_str(), problem.message.c_str());
+            if (problem.isError)
+                errorCount++;
+            else
+                warningCount++;
+        }
+    }
+
+    std::fprintf(stderr, "%zu scripts checked, %u errors, %u warnings\n", roots.size(), errorCount, warningCount);
+    return errorCount != 0;
+}
@@ -0,0 +1,448 @@
+#include <algorithm>
+#include <set>
+#include <sstream>
+#include "script_analysis.h"
+
+// Paths through one script are cut off after this many distinct states, which
+// only a loop that keeps creating things should reach.
+#define MAX_STATES 50000
+
+#define OBJ_PALETTE_COUNT 16
+#define OBJ_TILE_COUNT 1024
+#define TILE_SIZE_4BPP 32
+
+// What the script engine in src/battle_anim.c has outstanding at a command.
+struct ScriptState
+{
+    std::size_t pc;
+    long returnAddr;                 // sBattleAnimScriptRetAddr, -1 when not in a call
+    unsigned sprites;                // createsprite, until waitforvisualfinish
+    unsigned spriteTiles;            // tiles of those sprites that have no sheet
+    unsigned visualTasks;            // createvisualtask, until waitforvisualfinish
+    unsigned soundTasks;             // createsoundtask and the panning commands, until waitsound
+    unsigned newSprites;             // the same four, counting only those made since the
+    unsigned newSpriteTiles;         // last frame the script waited, which must all be
+    unsigned newVisualTasks;         // alive at once
+    unsigned newSoundTasks;
+    unsigned monBgTasks;             // sMonAnimTaskIdArray, from monbg to clearmonbg
+    unsigned fadeTasks;              // fadetobg and restorebg, until waitbgfadein
+    std::vector<std::string> sheets; // loaded tags, once per load
+    std::vector<std::string> indexed; // sAnimSpriteIndexArray, the sheets end frees
+    std::vector<std::string> taskSheets; // loaded by visual tasks, which end leaves alone
+
+    std::string GetKey() const
+    {
+        std::ostringstream key;
+
+        key << pc << ' ' << returnAddr << ' ' << sprites << ' ' << spriteTiles << ' ' << visualTasks << ' '
+            << soundTasks << ' ' << newSprites << ' ' << newSpriteTiles << ' ' << newVisualTasks << ' '
+            << newSoundTasks << ' ' << monBgTasks << ' ' << fadeTasks;
+        for (const std::string &tag : sheets)
+            key << ' ' << tag;
+        key << " |";
+        for (const std::string &tag : indexed)
+            key << ' ' << tag;
+        key << " |";
+        for (const std::string &tag : taskSheets)
+            key << ' ' << tag;
+        return key.str();
+    }
+};
+
+class ScriptAnalyzer
+{
+public:
+    ScriptAnalyzer(const AnimScriptFile &file, const AnimGfxData &gfx, const unsigned baseline[RESOURCE_COUNT])
+        : m_file(file), m_gfx(gfx), m_baseline(baseline), m_reachedEnd(false) {}
+
+    ScriptReport Analyze(const std::string &label);
+
+private:
+    void Run(ScriptState state);
+    bool Step(ScriptState &state);
+    bool Branch(ScriptState &state, const AnimCommand &command, const std::string &target);
+    void LoadSheet(ScriptState &state, const AnimCommand &command);
+    void UnloadSheet(ScriptState &state, const AnimCommand &command);
+    void CreateVisualTask(ScriptState &state, const AnimCommand &command);
+    void CreateSprite(ScriptState &state, const AnimCommand &command);
+    void CheckEnd(const ScriptState &state, const AnimCommand &command);
+    void UpdatePeaks(const ScriptState &state, unsigned line);
+    void AddProblem(bool isError, unsigned line, const std::string &message);
+
+    const AnimScriptFile &m_file;
+    const AnimGfxData &m_gfx;
+    const unsigned *m_baseline;
+    ScriptReport m_report;
+    std::vector<ScriptState> m_pending;
+    std::set<std::string> m_visited;
+    std::set<std::pair<unsigned, std::string>> m_reported;
+    bool m_reachedEnd;
+};
+
+ScriptReport ScriptAnalyzer::Analyze(const std::string &label)
+{
+    auto it = m_file.labels.find(label);
+
+    m_report.name = label;
+    for (int i = 0; i < RESOURCE_COUNT; i++)
+    {
+        m_report.peak[i] = m_report.certainPeak[i] = m_baseline[i];
+        m_report.peakLine[i] = m_report.certainPeakLine[i] = 0;
+    }
+
+    if (it == m_file.labels.end())
+    {
+        AddProblem(true, 0, "no such label");
+        return m_report;
+    }
+
+    ScriptState start;
+
+    start.pc = it->second;
+    start.returnAddr = -1;
+    start.sprites = start.spriteTiles = start.visualTasks = 0;
+    start.soundTasks = start.monBgTasks = start.fadeTasks = 0;
+    start.newSprites = start.newSpriteTiles = start.newVisualTasks = start.newSoundTasks = 0;
+    m_pending.push_back(start);
+
+    while (!m_pending.empty())
+    {
+        if (m_visited.size() >= MAX_STATES)
+        {
+            AddProblem(true, m_file.commands[m_pending.back().pc].line,
+                       "still running after " + std::to_string(MAX_STATES) + " states; a loop keeps creating objects");
+            break;
+        }
+
+        ScriptState state = m_pending.back();
+
+        m_pending.pop_back();
+        Run(state);
+    }
+
+    if (!m_reachedEnd && m_report.problems.empty())
+        AddProblem(true, m_file.commands[it->second].line, "never reaches end");
+    return m_report;
+}
+
+// Runs one path until it ends or forks; forks go on the pending list.
+void ScriptAnalyzer::Run(ScriptState state)
+{
+    for (;;)
+    {
+        if (state.pc >= m_file.commands.size())
+        {
+            AddProblem(true, m_file.commands.back().line, "runs past the end of the file");
+            return;
+        }
+        if (!m_visited.insert(state.GetKey()).second)
+            return;
+        if (!Step(state))
+            return;
+    }
+}
+
+bool ScriptAnalyzer::Step(ScriptState &state)
+{
+    const AnimCommand &command = m_file.commands[state.pc];
+    const std::string &name = command.name;
+
+    if (command.isData)
+    {
+        AddProblem(true, command.line, "runs into data");
+        return false;
+    }
+
+    state.pc++;
+    if (name == "delay" || name == "loadspritegfx" || name == "waitforvisualfinish")
+        state.newSprites = state.newSpriteTiles = state.newVisualTasks = state.newSoundTasks = 0;
+
+    if (name == "loadspritegfx")
+    {
+        LoadSheet(state, command);
+    }
+    else if (name == "unloadspritegfx")
+    {
+        UnloadSheet(state, command);
+    }
+    else if (name == "createsprite")
+    {
+        CreateSprite(state, command);
+    }
+    else if (name == "createvisualtask")
+    {
+        CreateVisualTask(state, command);
+    }
+    else if (name == "waitforvisualfinish")
+    {
+        state.sprites = state.spriteTiles = state.visualTasks = 0;
+    }
+    else if (name == "hang1" || name == "hang2")
+    {
+        AddProblem(true, command.line, name + " never finishes");
+        return false;
+    }
+    else if (name == "end")
+    {
+        CheckEnd(state, command);
+        return false;
+    }
+    else if (name == "monbg")
+    {
+        state.monBgTasks = 2;
+    }
+    else if (name == "clearmonbg")
+    {
+        state.monBgTasks = 0;
+    }
+    else if (name == "createsoundtask" || name == "panse_1B" || name == "panse_26" || name == "panse_27"
+          || name == "loopsewithpan" || name == "waitplaysewithpan")
+    {
+        state.soundTasks++;
+        state.newSoundTasks++;
+    }
+    else if (name == "waitsound")
+    {
+        state.soundTasks = state.newSoundTasks = 0;
+    }
+    else if (name == "fadetobg" || name == "fadetobgfromset" || name == "restorebg")
+    {
+        state.fadeTasks++;
+    }
+    else if (name == "waitbgfadein")
+    {
+        state.fadeTasks = 0;
+    }
+    else if (name == "call")
+    {
+        if (state.returnAddr >= 0)
+            AddProblem(false, command.line, "call inside a call loses the first return address");
+        state.returnAddr = state.pc;
+        return Branch(state, command, command.pointers.back());
+    }
+    else if (name == "return")
+    {
+        if (state.returnAddr < 0)
+        {
+            AddProblem(true, command.line, "return without a call");
+            return false;
+        }
+        state.pc = state.returnAddr;
+        state.returnAddr = -1;
+    }
+    else if (name == "goto")
+    {
+        return Branch(state, command, command.pointers.back());
+    }
+    else if (name == "jumpargeq" || name == "jumpifmoveturn" || name == "jumpifcontest")
+    {
+        ScriptState taken = state;
+
+        if (Branch(taken, command, command.pointers.back()))
+            m_pending.push_back(taken);
+    }
+    else if (name == "choosetwoturnanim")
+    {
+        ScriptState second = state;
+
+        if (Branch(second, command, command.pointers.back()))
+            m_pending.push_back(second);
+        return Branch(state, command, command.pointers.front());
+    }
+
+    UpdatePeaks(state, command.line);
+    return true;
+}
+
+bool ScriptAnalyzer::Branch(ScriptState &state, const AnimCommand &command, const std::string &target)
+{
+    auto it = m_file.labels.find(target);
+
+    if (it == m_file.labels.end())
+    {
+        AddProblem(true, command.line, "jumps to unknown label " + target);
+        return false;
+    }
+    state.pc = it->second;
+    return true;
+}
+
+void ScriptAnalyzer::LoadSheet(ScriptState &state, const AnimCommand &command)
+{
+    std::string tag = GetTagName(m_gfx, command.args[0]);
+
+    if (!m_gfx.sheetSizes.count(tag))
+    {
+        AddProblem(true, command.line, tag + " is not in gBattleAnimPicTable");
+        return;
+    }
+    if (std::find(state.sheets.begin(), state.sheets.end(), tag) != state.sheets.end())
+        AddProblem(false, command.line, tag + " is already loaded; its tiles are allocated again");
+
+    state.sheets.push_back(tag);
+    if (state.indexed.size() < m_gfx.maxAnimSheets)
+        state.indexed.push_back(tag);
+}
+
+void ScriptAnalyzer::UnloadSheet(ScriptState &state, const AnimCommand &command)
+{
+    std::string tag = GetTagName(m_gfx, command.args[0]);
+    auto sheet = std::find(state.sheets.begin(), state.sheets.end(), tag);
+    auto index = std::find(state.indexed.begin(), state.indexed.end(), tag);
+
+    if (sheet == state.sheets.end())
+    {
+        AddProblem(false, command.line, "unloads " + tag + ", which is not loaded");
+        return;
+    }
+    state.sheets.erase(sheet);
+    if (index != state.indexed.end())
+        state.indexed.erase(index);
+}
+
+void ScriptAnalyzer::CreateVisualTask(ScriptState &state, const AnimCommand &command)
+{
+    const std::string &taskName = command.pointers.front();
+    auto loads = m_gfx.taskLoads.find(taskName);
+    auto frees = m_gfx.taskFrees.find(taskName);
+
+    state.visualTasks++;
+    state.newVisualTasks++;
+    if (loads != m_gfx.taskLoads.end())
+    {
+        for (const std::string &tag : loads->second)
+        {
+            if (std::find(state.taskSheets.begin(), state.taskSheets.end(), tag) != state.taskSheets.end())
+                AddProblem(false, command.line, taskName + " loads " + tag + " again; its tiles are allocated again");
+            state.taskSheets.push_back(tag);
+        }
+    }
+    if (frees != m_gfx.taskFrees.end())
+    {
+        for (const std::string &tag : frees->second)
+        {
+            auto sheet = std::find(state.taskSheets.begin(), state.taskSheets.end(), tag);
+
+            if (sheet == state.taskSheets.end())
+                AddProblem(false, command.line, taskName + " frees " + tag + ", which no visual task loaded");
+            else
+                state.taskSheets.erase(sheet);
+        }
+    }
+}
+
+static bool IsLoaded(const ScriptState &state, const std::string &tag)
+{
+    return std::find(state.sheets.begin(), state.sheets.end(), tag) != state.sheets.end()
+        || std::find(state.taskSheets.begin(), state.taskSheets.end(), tag) != state.taskSheets.end();
+}
+
+void ScriptAnalyzer::CreateSprite(ScriptState &state, const AnimCommand &command)
+{
+    const std::string &templateName = command.pointers.front();
+    auto it = m_gfx.templates.find(templateName);
+
+    state.sprites++;
+    state.newSprites++;
+    if (it == m_gfx.templates.end())
+    {
+        AddProblem(false, command.line, "unknown sprite template " + templateName + "; its graphics are not checked");
+        return;
+    }
+
+    const AnimSpriteTemplate &spriteTemplate = it->second;
+    std::string tileTag = GetTagName(m_gfx, spriteTemplate.tileTag);
+    std::string paletteTag = GetTagName(m_gfx, spriteTemplate.paletteTag);
+
+    if (tileTag.empty())
+    {
+        state.spriteTiles += spriteTemplate.tiles;
+        state.newSpriteTiles += spriteTemplate.tiles;
+    }
+    else if (tileTag.compare(0, 9, "ANIM_TAG_") == 0 && !IsLoaded(state, tileTag))
+        AddProblem(true, command.line, templateName + " needs " + tileTag + ", which is not loaded");
+
+    if (paletteTag != tileTag && paletteTag.compare(0, 9, "ANIM_TAG_") == 0 && !IsLoaded(state, paletteTag))
+        AddProblem(false, command.line, templateName + " uses the palette of " + paletteTag + ", which is not loaded");
+}
+
+// end waits for every task, so only sheets it can't free are left over.
+void ScriptAnalyzer::CheckEnd(const ScriptState &state, const AnimCommand &command)
+{
+    std::vector<std::string> leaked = state.sheets;
+
+    m_reachedEnd = true;
+    for (const std::string &tag : state.indexed)
+        leaked.erase(std::find(leaked.begin(), leaked.end(), tag));
+
+    if (!leaked.empty())
+    {
+        std::string list;
+
+        for (const std::string &tag : leaked)
+            list += (list.empty() ? "" : ", ") + tag;
+        AddProblem(true, command.line, "ends with more than " + std::to_string(m_gfx.maxAnimSheets)
+                   + " sheets loaded; never freed: " + list);
+    }
+    for (const std::string &tag : state.taskSheets)
+        AddProblem(true, command.line, "ends with " + tag + " loaded by a visual task; never freed");
+}
+
+static void RecordPeaks(const unsigned baseline[RESOURCE_COUNT], const unsigned usage[RESOURCE_COUNT],
+                        unsigned line, unsigned peak[RESOURCE_COUNT], unsigned peakLine[RESOURCE_COUNT])
+{
+    for (int i = 0; i < RESOURCE_COUNT; i++)
+    {
+        if (baseline[i] + usage[i] > peak[i])
+        {
+            peak[i] = baseline[i] + usage[i];
+            peakLine[i] = line;
+        }
+    }
+}
+
+void ScriptAnalyzer::UpdatePeaks(const ScriptState &state, unsigned line)
+{
+    std::set<std::string> palettes(state.sheets.begin(), state.sheets.end());
+    unsigned sheetTiles = 0;
+    unsigned usage[RESOURCE_COUNT];
+    unsigned certain[RESOURCE_COUNT];
+
+    palettes.insert(state.taskSheets.begin(), state.taskSheets.end());
+    for (const std::string &tag : state.sheets)
+        sheetTiles += m_gfx.sheetSizes.at(tag) / TILE_SIZE_4BPP;
+    for (const std::string &tag : state.taskSheets)
+        sheetTiles += m_gfx.sheetSizes.count(tag) ? m_gfx.sheetSizes.at(tag) / TILE_SIZE_4BPP : 0;
+
+    usage[RESOURCE_SPRITES] = state.sprites;
+    usage[RESOURCE_TASKS] = state.visualTasks + state.soundTasks + state.monBgTasks + state.fadeTasks;
+    usage[RESOURCE_PALETTES] = palettes.size();
+    usage[RESOURCE_TILES] = sheetTiles + state.spriteTiles;
+    RecordPeaks(m_baseline, usage, line, m_report.peak, m_report.peakLine);
+
+    certain[RESOURCE_SPRITES] = state.newSprites;
+    certain[RESOURCE_TASKS] = state.newVisualTasks + state.newSoundTasks + state.monBgTasks + state.fadeTasks;
+    certain[RESOURCE_PALETTES] = palettes.size();
+    certain[RESOURCE_TILES] = sheetTiles + state.newSpriteTiles;
+    RecordPeaks(m_baseline, certain, line, m_report.certainPeak, m_report.certainPeakLine);
+}
+
+void ScriptAnalyzer::AddProblem(bool isError, unsigned line, const std::string &message)
+{
+    if (m_reported.insert(std::make_pair(line, message)).second)
+        m_report.problems.push_back({isError, line, message});
+}
+
+ScriptReport AnalyzeScript(const AnimScriptFile &file, const AnimGfxData &gfx, const std::string &label,
+                           const unsigned baseline[RESOURCE_COUNT])
+{
+    return ScriptAnalyzer(file, gfx, baseline).Analyze(label);
+}
+
+void GetResourceLimits(const AnimGfxData &gfx, unsigned limits[RESOURCE_COUNT])
+{
+    limits[RESOURCE_SPRITES] = gfx.maxSprites;
+    limits[RESOURCE_TASKS] = gfx.numTasks;
+    limits[RESOURCE_PALETTES] = OBJ_PALETTE_COUNT;
+    limits[RESOURCE_TILES] = OBJ_TILE_COUNT;
+}
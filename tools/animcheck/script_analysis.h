@@ -0,0 +1,46 @@
+#ifndef SCRIPT_ANALYSIS_H
+#define SCRIPT_ANALYSIS_H
+
+#include <string>
+#include <vector>
+#include "anim_gfx.h"
+#include "anim_script.h"
+
+enum AnimResource
+{
+    RESOURCE_SPRITES,
+    RESOURCE_TASKS,
+    RESOURCE_PALETTES, // OBJ palettes
+    RESOURCE_TILES,    // 4bpp OBJ tiles
+    RESOURCE_COUNT
+};
+
+struct ScriptProblem
+{
+    bool isError;
+    unsigned line;
+    std::string message;
+};
+
+struct ScriptReport
+{
+    std::string name;
+    unsigned peak[RESOURCE_COUNT];        // including the baseline
+    unsigned peakLine[RESOURCE_COUNT];
+    unsigned certainPeak[RESOURCE_COUNT]; // counting only what can't have finished yet
+    unsigned certainPeakLine[RESOURCE_COUNT];
+    std::vector<ScriptProblem> problems;
+};
+
+// Follows every path through the script starting at LABEL, counting what is
+// in use on top of BASELINE, which is whatever the battle screen already
+// holds. Sprites and tasks are counted as alive until the command that waits
+// for them, so the peaks are upper bounds; the certain peaks only count those
+// made since the script last let a frame pass.
+ScriptReport AnalyzeScript(const AnimScriptFile &file, const AnimGfxData &gfx, const std::string &label,
+                           const unsigned baseline[RESOURCE_COUNT]);
+
+// The most of each resource the game has.
+void GetResourceLimits(const AnimGfxData &gfx, unsigned limits[RESOURCE_COUNT]);
+
+#endif // SCRIPT_ANALYSIS_H
@@ -0,0 +1,278 @@
+// Host benchmark for the palette blend and tint lookup tables.
+//
+// Runs the per-color arithmetic the game used to do for palette fades,
+// weather gamma shifts with a blend and sepia tints next to the table-driven
+// versions in src/util.c, src/field_weather.c and src/palette.c, checks that
+// both produce the same colors, and reports the cost per 16-color palette.
+// The tables come from src/color_lut.c, the same code the game runs.
+// Host timings only give the relative cost; the GBA has no cache, so the
+// saved multiplies matter more there than here.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "gba/types.h"
+#include "color_lut.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC
+#endif
+
+#define FATAL_ERROR(format, ...)            \
+do                                          \
+{                                           \
+    fprintf(stderr, format, ##__VA_ARGS__); \
+    exit(1);                                \
+} while (0)
+
+#define NUM_PALETTES 32
+#define PALETTE_SIZE 16
+
+#define Q_8_8(n) ((int16_t)((n) * 256))
+
+static uint16_t sUnfaded[NUM_PALETTES * PALETTE_SIZE];
+static uint16_t sFaded[NUM_PALETTES * PALETTE_SIZE];
+static uint16_t sCheck[NUM_PALETTES * PALETTE_SIZE];
+static uint8_t sGammaTable[32];
+
+// Old per-color arithmetic
+
+static void OldBlendPalette(uint16_t *dest, const uint16_t *src, int count, uint8_t coeff, uint16_t blendColor)
+{
+    int8_t tr = blendColor & 0x1F, tg = (blendColor >> 5) & 0x1F, tb = (blendColor >> 10) & 0x1F;
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        int8_t r = src[i] & 0x1F;
+        int8_t g = (src[i] >> 5) & 0x1F;
+        int8_t b = (src[i] >> 10) & 0x1F;
+
+        dest[i] = ((r + (((tr - r) * coeff) >> 4)) << 0)
+                | ((g + (((tg - g) * coeff) >> 4)) << 5)
+                | ((b + (((tb - b) * coeff) >> 4)) << 10);
+    }
+}
+
+static void OldGammaShiftWithBlend(uint16_t *dest, const uint16_t *src, int count, uint8_t coeff, uint16_t blendColor)
+{
+    uint8_t tr = blendColor & 0x1F, tg = (blendColor >> 5) & 0x1F, tb = (blendColor >> 10) & 0x1F;
+    int i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint8_t r = sGammaTable[src[i] & 0x1F];
+        uint8_t g = sGammaTable[(src[i] >> 5) & 0x1F];
+        uint8_t b = sGammaTable[(src[i] >> 10) & 0x1F];
+
+        r += ((tr - r) * coeff) >> 4;
+        g += ((tg - g) * coeff) >> 4;
+        b += ((tb - b) * coeff) >> 4;
+        dest[i] = (b << 10) | (g << 5) | r;
+    }
+}
+
+static void OldSepiaTone(uint16_t *palette, int count)
+{
+    int32_t r, g, b, i;
+    uint32_t gray;
+
+    for (i = 0; i < count; i++)
+    {
+        r = (*palette >>  0) & 0x1F;
+        g = (*palette >>  5) & 0x1F;
+        b = (*palette >> 10) & 0x1F;
+
+        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+
+        r = (uint16_t)((Q_8_8(1.2) * gray)) >> 8;
+        g = (uint16_t)((Q_8_8(1.0) * gray)) >> 8;
+        b = (uint16_t)((Q_8_8(0.94) * gray)) >> 8;
+
+        if (r > 31)
+            r = 31;
+
+        *palette++ = (b << 10) | (g << 5) | (r << 0);
+    }
+}
+
+// Table-driven versions
+
+static void NewBlendPalette(uint16_t *dest, const uint16_t *src, int count, uint8_t coeff, uint16_t blendColor)
+{
+    SetColorBlend(coeff, blendColor);
+    while (count--)
+    {
+        uint32_t color = *src++;
+        *dest++ = BLEND_COLOR(color & 0x1F, (color >> 5) & 0x1F, (color >> 10) & 0x1F);
+    }
+}
+
+static void NewGammaShiftWithBlend(uint16_t *dest, const uint16_t *src, int count, uint8_t coeff, uint16_t blendColor)
+{
+    int i;
+
+    SetColorBlend(coeff, blendColor);
+    for (i = 0; i < count; i++)
+        dest[i] = BLEND_COLOR(sGammaTable[src[i] & 0x1F], sGammaTable[(src[i] >> 5) & 0x1F], sGammaTable[(src[i] >> 10) & 0x1F]);
+}
+
+static void NewSepiaTone(uint16_t *palette, int count)
+{
+    int32_t r, g, b, i;
+    uint32_t gray;
+
+    SetToneLut(Q_8_8(1.2), Q_8_8(1.0), Q_8_8(0.94));
+    for (i = 0; i < count; i++)
+    {
+        r = (*palette >>  0) & 0x1F;
+        g = (*palette >>  5) & 0x1F;
+        b = (*palette >> 10) & 0x1F;
+
+        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+
+        *palette++ = gToneLut[gray];
+    }
+}
+
+// Checks
+
+static void Verify(void)
+{
+    static uint16_t all[0x8000], a[0x8000], b[0x8000];
+    static const uint16_t targets[] = {0x0000, 0x7FFF, 0x001F, 0x03E0, 0x7C00, 0x294A, 0x5A1C};
+    unsigned i, t, coeff;
+
+    for (i = 0; i < 0x8000; i++)
+        all[i] = i;
+
+    for (t = 0; t < sizeof(targets) / sizeof(targets[0]); t++)
+    {
+        for (coeff = 0; coeff <= 16; coeff++)
+        {
+            OldBlendPalette(a, all, 0x8000, coeff, targets[t]);
+            NewBlendPalette(b, all, 0x8000, coeff, targets[t]);
+            if (memcmp(a, b, sizeof(a)) != 0)
+                FATAL_ERROR("blend mismatch for coeff %u color 0x%04X\n", coeff, targets[t]);
+
+            OldGammaShiftWithBlend(a, all, 0x8000, coeff, targets[t]);
+            NewGammaShiftWithBlend(b, all, 0x8000, coeff, targets[t]);
+            if (memcmp(a, b, sizeof(a)) != 0)
+                FATAL_ERROR("gamma blend mismatch for coeff %u color 0x%04X\n", coeff, targets[t]);
+        }
+    }
+
+    memcpy(a, all, sizeof(a));
+    memcpy(b, all, sizeof(b));
+    OldSepiaTone(a, 0x8000);
+    NewSepiaTone(b, 0x8000);
+    if (memcmp(a, b, sizeof(a)) != 0)
+        FATAL_ERROR("sepia mismatch\n");
+}
+
+// Timing
+
+struct Timer
+{
+    struct timespec start;
+#ifdef HAVE_RDTSC
+    uint64_t startCycles;
+#endif
+};
+
+static void StartTimer(struct Timer *timer)
+{
+    clock_gettime(CLOCK_MONOTONIC, &timer->start);
+#ifdef HAVE_RDTSC
+    timer->startCycles = __rdtsc();
+#endif
+}
+
+static void StopTimer(struct Timer *timer, const char *name, unsigned long palettes)
+{
+    struct timespec end;
+    double ns;
+
+#ifdef HAVE_RDTSC
+    uint64_t cycles = __rdtsc() - timer->startCycles;
+#endif
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    ns = (end.tv_sec - timer->start.tv_sec) * 1e9 + (end.tv_nsec - timer->start.tv_nsec);
+
+#ifdef HAVE_RDTSC
+    printf("  %-24s %8.1f ns %8.1f cycles per palette\n", name, ns / palettes, (double)cycles / palettes);
+#else
+    printf("  %-24s %8.1f ns per palette\n", name, ns / palettes);
+#endif
+}
+
+typedef void (*BlendFunc)(uint16_t *, const uint16_t *, int, uint8_t, uint16_t);
+
+// A full fade: every frame blends all 32 palettes with the next coefficient,
+// the way UpdateNormalPaletteFade does.
+static void BenchFade(const char *name, BlendFunc func, unsigned frames)
+{
+    struct Timer timer;
+    unsigned frame, pal;
+
+    StartTimer(&timer);
+    for (frame = 0; frame < frames; frame++)
+    {
+        for (pal = 0; pal < NUM_PALETTES; pal++)
+            func(&sFaded[pal * PALETTE_SIZE], &sUnfaded[pal * PALETTE_SIZE], PALETTE_SIZE, frame % 17, 0x0000);
+    }
+    StopTimer(&timer, name, (unsigned long)frames * NUM_PALETTES);
+}
+
+static void BenchSepia(const char *name, void (*func)(uint16_t *, int), unsigned frames)
+{
+    struct Timer timer;
+    unsigned frame;
+
+    StartTimer(&timer);
+    for (frame = 0; frame < frames; frame++)
+    {
+        memcpy(sFaded, sUnfaded, sizeof(sFaded));
+        func(sFaded, NUM_PALETTES * PALETTE_SIZE);
+    }
+    StopTimer(&timer, name, (unsigned long)frames * NUM_PALETTES);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned frames = 200000;
+    unsigned i;
+
+    if (argc > 2)
+        FATAL_ERROR("USAGE: blendbench [FRAMES]\n");
+    if (argc == 2)
+        frames = strtoul(argv[1], NULL, 0);
+
+    srand(1);
+    for (i = 0; i < NUM_PALETTES * PALETTE_SIZE; i++)
+        sUnfaded[i] = rand() & 0x7FFF;
+    for (i = 0; i < 32; i++)
+        sGammaTable[i] = (i * 3 / 4) + 4;
+
+    Verify();
+    printf("tables match the per-color arithmetic\n");
+
+    printf("palette fade:\n");
+    BenchFade("per-color", OldBlendPalette, frames);
+    BenchFade("lookup table", NewBlendPalette, frames);
+
+    printf("weather gamma shift with blend:\n");
+    BenchFade("per-color", OldGammaShiftWithBlend, frames);
+    BenchFade("lookup table", NewGammaShiftWithBlend, frames);
+
+    printf("sepia tint:\n");
+    BenchSepia("per-color", OldSepiaTone, frames);
+    BenchSepia("lookup table", NewSepiaTone, frames);
+
+    memcpy(sCheck, sFaded, sizeof(sCheck));
+    return sCheck[0] == 0xFFFF;
+}
@@ -0,0 +1,250 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <string>
+#include <vector>
+#include "dexorder.h"
+
+struct DexEntry
+{
+    std::string constant; // name after NATIONAL_DEX_
+    unsigned dexNum;
+    std::string name;
+    unsigned height;
+    unsigned weight;
+};
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: dexorder SPECIES_H SPECIES_NAMES_H POKEDEX_ENTRIES_H OUTPUT\n"
+        "\n"
+        "Writes the Pokedex sort orders and their rank tables for the national\n"
+        "dex numbers defined in SPECIES_H.\n");
+    std::exit(1);
+}
+
+static std::string ReadWholeFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("Error: Cannot open file \"%s\" for reading.\n", path.c_str());
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+// Removed species are commented out rather than deleted, so comments have
+// to go before anything is matched.
+static std::string StripComments(const std::string &text)
+{
+    std::string result;
+    std::size_t i = 0;
+
+    while (i < text.size())
+    {
+        if (text.compare(i, 2, "//") == 0)
+        {
+            i = text.find('\n', i);
+            if (i == std::string::npos)
+                break;
+        }
+        else if (text.compare(i, 2, "/*") == 0)
+        {
+            i = text.find("*/", i + 2);
+            if (i == std::string::npos)
+                break;
+            i += 2;
+            result += ' ';
+        }
+        else if (text[i] == '"')
+        {
+            std::size_t end = i + 1;
+
+            while (end < text.size() && text[end] != '"' && text[end] != '\n')
+                end += text[end] == '\\' ? 2 : 1;
+            result.append(text, i, end + 1 - i);
+            i = end + 1;
+        }
+        else
+        {
+            result += text[i++];
+        }
+    }
+    return result;
+}
+
+static std::vector<DexEntry> ReadDexNumbers(const std::string &path, unsigned &dexCount)
+{
+    std::string text = StripComments(ReadWholeFile(path));
+    std::regex define("^#define NATIONAL_DEX_(\\w+) +(\\d+)[ \\t\\r]*$");
+    std::vector<DexEntry> entries;
+    std::size_t lineStart = 0;
+
+    dexCount = 0;
+    while (lineStart < text.size())
+    {
+        std::size_t lineEnd = std::min(text.find('\n', lineStart), text.size());
+        std::string line = text.substr(lineStart, lineEnd - lineStart);
+        std::smatch match;
+
+        lineStart = lineEnd + 1;
+        if (line.compare(0, 20, "#define NATIONAL_DEX") != 0 || !std::regex_match(line, match, define))
+            continue;
+        if (match[1] == "COUNT")
+            dexCount = std::stoul(match[2]);
+        else
+            entries.push_back({match[1], (unsigned)std::stoul(match[2]), "", 0, 0});
+    }
+
+    if (dexCount == 0)
+        FATAL_ERROR("Error: No NATIONAL_DEX_COUNT in \"%s\".\n", path.c_str());
+
+    // Forms numbered past the count have no seen/caught flags.
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [dexCount](const DexEntry &entry) {
+        return entry.dexNum == 0 || entry.dexNum >= dexCount;
+    }), entries.end());
+    return entries;
+}
+
+static void ReadNames(const std::string &path, std::vector<DexEntry> &entries)
+{
+    std::string text = StripComments(ReadWholeFile(path));
+    std::regex pattern("\\[SPECIES_(\\w+)\\]\\s*=\\s*_\\(\"((?:[^\"\\\\]|\\\\.)*)\"\\)");
+    std::map<std::string, std::string> names;
+
+    for (std::sregex_iterator it(text.begin(), text.end(), pattern), end; it != end; ++it)
+        names[(*it)[1]] = (*it)[2];
+
+    for (DexEntry &entry : entries)
+    {
+        auto it = names.find(entry.constant);
+
+        if (it == names.end())
+            FATAL_ERROR("Error: No name for SPECIES_%s in \"%s\".\n", entry.constant.c_str(), path.c_str());
+        entry.name = it->second;
+    }
+}
+
+static void ReadHeightsAndWeights(const std::string &path, std::vector<DexEntry> &entries)
+{
+    std::string text = StripComments(ReadWholeFile(path));
+    std::regex header("\\[NATIONAL_DEX_(\\w+)\\]\\s*=");
+    std::regex height("\\.height\\s*=\\s*(\\d+)");
+    std::regex weight("\\.weight\\s*=\\s*(\\d+)");
+    std::map<std::string, std::pair<unsigned, unsigned>> sizes;
+    std::vector<std::pair<std::string, std::size_t>> starts;
+
+    for (std::sregex_iterator it(text.begin(), text.end(), header), end; it != end; ++it)
+        starts.push_back({(*it)[1], (std::size_t)it->position() + it->length()});
+
+    for (std::size_t i = 0; i < starts.size(); i++)
+    {
+        std::size_t end = i + 1 < starts.size() ? starts[i + 1].second : text.size();
+        std::string body = text.substr(starts[i].second, end - starts[i].second);
+        std::smatch heightMatch;
+        std::smatch weightMatch;
+
+        if (std::regex_search(body, heightMatch, height) && std::regex_search(body, weightMatch, weight))
+            sizes[starts[i].first] = {std::stoul(heightMatch[1]), std::stoul(weightMatch[1])};
+    }
+
+    for (DexEntry &entry : entries)
+    {
+        auto it = sizes.find(entry.constant);
+
+        if (it == sizes.end())
+            FATAL_ERROR("Error: No height and weight for NATIONAL_DEX_%s in \"%s\".\n", entry.constant.c_str(), path.c_str());
+        entry.height = it->second.first;
+        entry.weight = it->second.second;
+    }
+}
+
+static std::string GetSortName(const std::string &name)
+{
+    std::string sortName = name;
+
+    for (char &c : sortName)
+    {
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+    }
+    return sortName;
+}
+
+static void WriteOrder(FILE *fp, const char *suffix, const std::vector<DexEntry> &order, unsigned dexCount)
+{
+    std::vector<unsigned> ranks(dexCount, 0xFFFF);
+
+    std::fprintf(fp, "const u16 gPokedexOrder_%s[] =\n{\n", suffix);
+    for (std::size_t i = 0; i < order.size(); i++)
+    {
+        std::fprintf(fp, "    NATIONAL_DEX_%s,\n", order[i].constant.c_str());
+        ranks[order[i].dexNum] = i;
+    }
+    std::fprintf(fp, "};\n\n");
+
+    std::fprintf(fp, "const u16 gPokedexRank_%s[NATIONAL_DEX_COUNT] =\n{\n", suffix);
+    for (unsigned dexNum = 0; dexNum < dexCount; dexNum++)
+    {
+        if (ranks[dexNum] == 0xFFFF)
+            std::fprintf(fp, "    [%u] = 0xFFFF,\n", dexNum);
+    }
+    for (const DexEntry &entry : order)
+        std::fprintf(fp, "    [NATIONAL_DEX_%s] = %u,\n", entry.constant.c_str(), ranks[entry.dexNum]);
+    std::fprintf(fp, "};\n\n");
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 5)
+        PrintUsage();
+
+    unsigned dexCount;
+    std::vector<DexEntry> entries = ReadDexNumbers(argv[1], dexCount);
+
+    ReadNames(argv[2], entries);
+    ReadHeightsAndWeights(argv[3], entries);
+
+    std::sort(entries.begin(), entries.end(), [](const DexEntry &a, const DexEntry &b) { return a.dexNum < b.dexNum; });
+    for (std::size_t i = 1; i < entries.size(); i++)
+    {
+        if (entries[i].dexNum == entries[i - 1].dexNum)
+            FATAL_ERROR("Error: NATIONAL_DEX_%s and NATIONAL_DEX_%s are both %u.\n",
+                        entries[i - 1].constant.c_str(), entries[i].constant.c_str(), entries[i].dexNum);
+    }
+
+    FILE *fp = std::fopen(argv[4], "w");
+
+    if (fp == nullptr)
+        FATAL_ERROR("Error: Cannot open file \"%s\" for writing.\n", argv[4]);
+
+    std::fprintf(fp,
+        "// Generated by tools/dexorder from include/constants/species.h, species names\n"
+        "// and Pokedex entries. Do not edit.\n"
+        "//\n"
+        "// gPokedexRank_* gives the position of each national dex number in the\n"
+        "// matching order, or 0xFFFF for numbers that aren't in it. Ties are broken\n"
+        "// by dex number.\n\n");
+
+    std::vector<DexEntry> order = entries;
+
+    std::stable_sort(order.begin(), order.end(), [](const DexEntry &a, const DexEntry &b) {
+        return GetSortName(a.name) < GetSortName(b.name);
+    });
+    WriteOrder(fp, "Alphabetical", order, dexCount);
+
+    order = entries;
+    std::stable_sort(order.begin(), order.end(), [](const DexEntry &a, const DexEntry &b) { return a.weight < b.weight; });
+    WriteOrder(fp, "Weight", order, dexCount);
+
+    order = entries;
+    std::stable_sort(order.begin(), order.end(), [](const DexEntry &a, const DexEntry &b) { return a.height < b.height; });
+    WriteOrder(fp, "Height", order, dexCount);
+
+    std::fclose(fp);
+    return 0;
+}
@@ -0,0 +1,30 @@
+// The glyph tables data/fonts.s puts in the ROM.
+
+#include "global.h"
+
+const u16 gFont8LatinGlyphs[] = INCBIN_U16("graphics/fonts/font8.latfont");
+const u8 gFont8LatinGlyphWidths[] = {
+#include "font8_latin_widths.h"
+};
+const u16 gFont0LatinGlyphs[] = INCBIN_U16("graphics/fonts/font0.latfont");
+const u8 gFont0LatinGlyphWidths[] = {
+#include "font0_latin_widths.h"
+};
+const u16 gFont7LatinGlyphs[] = INCBIN_U16("graphics/fonts/font7.latfont");
+const u8 gFont7LatinGlyphWidths[] = {
+#include "font7_latin_widths.h"
+};
+const u16 gFont2LatinGlyphs[] = INCBIN_U16("graphics/fonts/font2.latfont");
+const u8 gFont2LatinGlyphWidths[] = {
+#include "font2_latin_widths.h"
+};
+const u16 gFont1LatinGlyphs[] = INCBIN_U16("graphics/fonts/font1.latfont");
+const u8 gFont1LatinGlyphWidths[] = {
+#include "font1_latin_widths.h"
+};
+const u16 gFont0JapaneseGlyphs[] = INCBIN_U16("graphics/fonts/font0.hwjpnfont");
+const u16 gFont1JapaneseGlyphs[] = INCBIN_U16("graphics/fonts/font1.hwjpnfont");
+const u16 gFont2JapaneseGlyphs[] = INCBIN_U16("graphics/fonts/font2.fwjpnfont");
+const u8 gFont2JapaneseGlyphWidths[] = {
+#include "font2_japanese_widths.h"
+};
@@ -0,0 +1,89 @@
+// Writes every _("...") in the given files out as STRING(_("...")), so
+// glyphbench can list them all and preproc encodes them as the game does.
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static char *ReadFile(const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    char *buffer;
+    long size;
+
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Error: Can't open \"%s\".\n", path);
+        exit(1);
+    }
+
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    buffer = malloc(size + 1);
+    if (buffer == NULL || fread(buffer, 1, size, fp) != (size_t)size)
+    {
+        fprintf(stderr, "Error: Can't read \"%s\".\n", path);
+        exit(1);
+    }
+    buffer[size] = '\0';
+    fclose(fp);
+    return buffer;
+}
+
+static int IsIdentChar(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+// Copies the arguments of the _( at text out, up to its closing paren.
+static const char *WriteString(const char *text, const char *path)
+{
+    int inString = 0;
+
+    fputs("STRING(_(", stdout);
+    for (; *text != '\0'; text++)
+    {
+        if (inString)
+        {
+            if (*text == '\\' && text[1] != '\0')
+                putchar(*text++);
+            else if (*text == '"')
+                inString = 0;
+        }
+        else if (*text == '"')
+        {
+            inString = 1;
+        }
+        else if (*text == ')')
+        {
+            puts("))");
+            return text + 1;
+        }
+        putchar(*text);
+    }
+
+    fprintf(stderr, "Error: Unterminated _( in \"%s\".\n", path);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        char *buffer = ReadFile(argv[i]);
+        const char *text = buffer;
+
+        while (*text != '\0')
+        {
+            if (text[0] == '_' && text[1] == '(' && (text == buffer || !IsIdentChar(text[-1])))
+                text = WriteString(text + 2, argv[i]);
+            else
+                text++;
+        }
+        free(buffer);
+    }
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "global.h"
+#include "malloc.h"
+#include "text.h"
+#include "window.h"
+
+// Renders every string in src/data/text with gflib/text.c, without and then
+// with the glyph cache, and reports how fast glyphs go through RenderText.
+// The rendered pixels are also compared, so a cache that hands back the
+// wrong glyph fails the run.
+
+#define WINDOW_WIDTH  32 // tiles
+#define WINDOW_HEIGHT 8
+#define WINDOW_BYTES  (WINDOW_WIDTH * WINDOW_HEIGHT * TILE_SIZE_4BPP)
+
+#define MAX_STRINGS 8192
+
+// Fonts 0, 1 and 2: the small, normal and narrow message box fonts, which
+// have a latin glyph table each.
+static const u8 sFonts[] = {0, 1, 2};
+
+extern struct TextPrinter gTextPrinters[];
+extern const u8 *const gBenchStrings[];
+extern const u32 gBenchStringCount;
+
+static u8 sWindowPixels[WINDOW_BYTES];
+static u32 sUncachedHashes[ARRAY_COUNT(sFonts) * MAX_STRINGS];
+static u32 sCachedHashes[ARRAY_COUNT(sFonts) * MAX_STRINGS];
+static u8 sHeap[HEAP_SIZE] __attribute__((aligned(4)));
+
+static double GetTime(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+// Prints str in the window the way a message box does and returns how many
+// glyphs were drawn.
+static u32 RenderString(u8 fontId, const u8 *str)
+{
+    u32 glyphs = 0;
+    u32 steps;
+    u32 ret;
+
+    AddTextPrinterParameterized(0, fontId, str, 0, 1, 1, NULL);
+    for (steps = 0; steps < 0x10000; steps++)
+    {
+        ret = RenderFont(&gTextPrinters[0]);
+        if (ret == 1)
+            return glyphs;
+        if (ret == 0)
+            glyphs++;
+    }
+
+    fprintf(stderr, "Error: A string never finished printing.\n");
+    exit(1);
+}
+
+static u32 RenderAllStrings(void)
+{
+    u32 glyphs = 0;
+    u32 i, j;
+
+    for (i = 0; i < ARRAY_COUNT(sFonts); i++)
+    {
+        for (j = 0; j < gBenchStringCount; j++)
+            glyphs += RenderString(sFonts[i], gBenchStrings[j]);
+    }
+    return glyphs;
+}
+
+// A hash of each string's pixels, drawn on a cleared window.
+static void HashRenderedStrings(u32 *hashes)
+{
+    u32 i, j, k;
+
+    for (i = 0; i < ARRAY_COUNT(sFonts); i++)
+    {
+        for (j = 0; j < gBenchStringCount; j++)
+        {
+            u32 hash = 2166136261u;
+
+            FillWindowPixelBuffer(0, PIXEL_FILL(1));
+            RenderString(sFonts[i], gBenchStrings[j]);
+            for (k = 0; k < WINDOW_BYTES; k++)
+                hash = (hash ^ sWindowPixels[k]) * 16777619u;
+            *hashes++ = hash;
+        }
+    }
+}
+
+// The fastest of several passes, which is the one least disturbed by
+// whatever else the host is doing.
+static double MeasureGlyphsPerMs(u32 passes)
+{
+    double best = 0;
+    double start, rate;
+    u32 glyphs;
+    u32 i;
+
+    RenderAllStrings();
+    for (i = 0; i < passes; i++)
+    {
+        start = GetTime();
+        glyphs = RenderAllStrings();
+        rate = glyphs / (GetTime() - start);
+        if (rate > best)
+            best = rate;
+    }
+    return best;
+}
+
+int main(int argc, char **argv)
+{
+    u32 passes = 20;
+    u32 hashCount;
+    struct HeapStats heapStats;
+    double uncachedRate;
+    double cachedRate;
+    u32 i;
+
+    if (argc > 2 || (argc == 2 && (passes = strtoul(argv[1], NULL, 0)) == 0))
+    {
+        fprintf(stderr, "USAGE: glyphbench [PASSES]\n");
+        return 1;
+    }
+
+    gWindows[0].window.width = WINDOW_WIDTH;
+    gWindows[0].window.height = WINDOW_HEIGHT;
+    gWindows[0].tileData = sWindowPixels;
+    gSaveBlock2Ptr->autobattle = TRUE; // so prompts don't wait for A
+    SetDefaultFontsPointer();
+
+    if (gBenchStringCount > MAX_STRINGS)
+    {
+        fprintf(stderr, "Error: More than %u strings.\n", MAX_STRINGS);
+        return 1;
+    }
+    hashCount = ARRAY_COUNT(sFonts) * gBenchStringCount;
+
+    // The cache only exists once InitGlyphCache has been called.
+    HashRenderedStrings(sUncachedHashes);
+    uncachedRate = MeasureGlyphsPerMs(passes);
+
+    InitHeap(sHeap, HEAP_SIZE);
+    InitGlyphCache();
+    GetHeapStats(&heapStats);
+    if (heapStats.bytesUsed == 0)
+    {
+        fprintf(stderr, "Error: The glyph cache wasn't allocated.\n");
+        return 1;
+    }
+
+    cachedRate = MeasureGlyphsPerMs(passes);
+    HashRenderedStrings(sCachedHashes);
+
+    for (i = 0; i < hashCount; i++)
+    {
+        if (sUncachedHashes[i] != sCachedHashes[i])
+        {
+            fprintf(stderr, "Error: String %u in font %u renders differently with the cache.\n",
+                    i % gBenchStringCount, sFonts[i / gBenchStringCount]);
+            return 1;
+        }
+    }
+
+    printf("%u strings, %u fonts, %u passes\n", gBenchStringCount, (u32)ARRAY_COUNT(sFonts), passes);
+    printf("cache off: %8.0f glyphs/ms\n", uncachedRate);
+    printf("cache on:  %8.0f glyphs/ms (%.2fx)\n", cachedRate, cachedRate / uncachedRate);
+    printf("heap used by the cache: %u bytes\n", heapStats.bytesUsed);
+    return 0;
+}
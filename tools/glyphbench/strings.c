@@ -0,0 +1,12 @@
+// Every string in src/data/text, encoded by preproc.
+
+#include "global.h"
+
+#define STRING(s) (const u8[])s,
+
+const u8 *const gBenchStrings[] =
+{
+#include "strings.inc"
+};
+
+const u32 gBenchStringCount = ARRAY_COUNT(gBenchStrings);
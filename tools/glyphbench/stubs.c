@@ -0,0 +1,73 @@
+// What text.c needs from the rest of the game. Windows keep their pixels in
+// tileData as in the game; nothing else has any effect.
+
+#include "global.h"
+#include "battle.h"
+#include "blit.h"
+#include "main.h"
+#include "m4a.h"
+#include "menu.h"
+#include "sound.h"
+#include "string_util.h"
+#include "text.h"
+#include "window.h"
+#include "dynamic_placeholder_text_util.h"
+
+#define WINDOWS_MAX 32 // as in window.c
+
+static struct SaveBlock2 sSaveBlock2;
+static const u8 sEmptyString[] = {EOS};
+
+struct Window gWindows[WINDOWS_MAX];
+struct Main gMain;
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+struct MusicPlayerInfo gMPlayInfo_BGM;
+u32 gBattleTypeFlags;
+u8 gStringVar1[0x100] = {EOS};
+u8 gStringVar2[0x100] = {EOS};
+u8 gStringVar3[0x100] = {EOS};
+u8 gRyuStringVar1[0x100] = {EOS};
+u8 gRyuStringVar2[0x100] = {EOS};
+u8 gRyuStringVar3[0x100] = {EOS};
+
+void CpuSet(const void *src, void *dest, u32 control)
+{
+    u32 count = control & 0x1FFFFF;
+    u32 i;
+
+    if (control & CPU_SET_32BIT)
+    {
+        for (i = 0; i < count; i++)
+            ((u32 *)dest)[i] = (control & CPU_SET_SRC_FIXED) ? *(const u32 *)src : ((const u32 *)src)[i];
+    }
+    else
+    {
+        for (i = 0; i < count; i++)
+            ((u16 *)dest)[i] = (control & CPU_SET_SRC_FIXED) ? *(const u16 *)src : ((const u16 *)src)[i];
+    }
+}
+
+void FillWindowPixelBuffer(u8 windowId, u8 fillValue)
+{
+    memset(gWindows[windowId].tileData, fillValue, gWindows[windowId].window.width * gWindows[windowId].window.height * 32);
+}
+
+void FillWindowPixelRect(u8 windowId, u8 fillValue, u16 x, u16 y, u16 width, u16 height) {}
+void BlitBitmapRectToWindow(u8 windowId, const u8 *pixels, u16 srcX, u16 srcY, u16 srcWidth, int srcHeight, u16 destX, u16 destY, u16 rectWidth, u16 rectHeight) {}
+void CopyWindowDirtyTilesToVram(u8 windowId) {}
+void MarkWindowRectDirty(u8 windowId, u16 x, u16 y, u16 width, u16 height) {}
+void ScrollWindow(u8 windowId, u8 direction, u8 distance, u8 fillValue) {}
+void FillBitmapRect4Bit(struct Bitmap *surface, u16 x, u16 y, u16 width, u16 height, u8 fillValue) {}
+void PlayBGM(u16 songNum) {}
+void PlaySE(u16 songNum) {}
+bool8 IsSEPlaying(void) { return FALSE; }
+void m4aMPlayStop(struct MusicPlayerInfo *mplayInfo) {}
+void m4aMPlayContinue(struct MusicPlayerInfo *mplayInfo) {}
+u32 GetPlayerTextSpeed(void) { return 0; }
+u16 Font6Func(struct TextPrinter *textPrinter) { return 1; }
+u32 GetGlyphWidthFont6(u16 glyphId, bool32 isJapanese) { return 0; }
+
+const u8 *DynamicPlaceholderTextUtil_GetPlaceholderPtr(u8 idx)
+{
+    return sEmptyString;
+}
@@ -0,0 +1,192 @@
+#include <dirent.h>
+#include <sys/stat.h>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "lzcheck.h"
+#include "gba/types.h"
+
+extern "C" {
+#include "lz_decoder.h"
+unsigned char *LZDecompress(unsigned char *src, int srcSize, int *uncompressedSize);
+}
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: lzcheck [PATH...]\n"
+        "\n"
+        "Decompresses every .lz file under each PATH (default graphics) with the\n"
+        "game's resumable LZ decoder, stopping and resuming it at different\n"
+        "points, and checks the output against a plain LZ77 decompression.\n"
+        "Run from the repo root after building the graphics.\n");
+    std::exit(1);
+}
+
+static bool HasSuffix(const std::string &s, const char *suffix)
+{
+    size_t len = std::strlen(suffix);
+    return s.size() >= len && s.compare(s.size() - len, len, suffix) == 0;
+}
+
+static void FindLzFiles(const std::string &path, std::vector<std::string> &files)
+{
+    struct stat st;
+
+    if (stat(path.c_str(), &st) != 0)
+        FATAL_ERROR("Error: Can't open \"%s\".\n", path.c_str());
+
+    if (!S_ISDIR(st.st_mode))
+    {
+        files.push_back(path);
+        return;
+    }
+
+    DIR *dir = opendir(path.c_str());
+    if (dir == nullptr)
+        FATAL_ERROR("Error: Can't open directory \"%s\".\n", path.c_str());
+
+    while (struct dirent *entry = readdir(dir))
+    {
+        std::string name = entry->d_name;
+        std::string child = path + "/" + name;
+
+        if (name == "." || name == "..")
+            continue;
+        if (stat(child.c_str(), &st) != 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+            FindLzFiles(child, files);
+        else if (HasSuffix(name, ".lz"))
+            files.push_back(child);
+    }
+    closedir(dir);
+}
+
+static std::vector<unsigned char> ReadFile(const std::string &path)
+{
+    FILE *fp = std::fopen(path.c_str(), "rb");
+
+    if (fp == nullptr)
+        FATAL_ERROR("Error: Can't open \"%s\".\n", path.c_str());
+
+    std::fseek(fp, 0, SEEK_END);
+    long size = std::ftell(fp);
+    std::fseek(fp, 0, SEEK_SET);
+
+    std::vector<unsigned char> data(size);
+    if (size != 0 && std::fread(data.data(), size, 1, fp) != 1)
+        FATAL_ERROR("Error: Can't read \"%s\".\n", path.c_str());
+    std::fclose(fp);
+    return data;
+}
+
+// Runs the decoder in slices of the sizes CHUNK gives and returns where the
+// output first differs from EXPECTED, or -1 if it all matches.
+template <typename ChunkFunc>
+static long DecodeInChunks(std::vector<u32> &src, const std::vector<unsigned char> &expected, ChunkFunc chunk)
+{
+    // One spare byte for the halfword write at the end of an odd size.
+    std::vector<unsigned char> dest(expected.size() + 2, 0xAA);
+    struct LZDecoder decoder;
+    size_t calls = 0;
+
+    LZDecoderInit(&decoder, src.data(), dest.data());
+    while (!LZDecoderRun(&decoder, chunk()))
+    {
+        if (++calls > expected.size() + 1)
+            return decoder.pos;
+    }
+
+    if (decoder.size != expected.size())
+        return 0;
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        if (dest[i] != expected[i])
+            return i;
+    }
+    if (dest[expected.size()] != 0xAA)
+        return expected.size();
+    return -1;
+}
+
+static bool CheckFile(const std::string &path, std::mt19937 &rng)
+{
+    std::vector<unsigned char> data = ReadFile(path);
+    int expectedSize;
+
+    if (data.size() < 4 || data[0] != 0x10)
+    {
+        std::fprintf(stderr, "%s: not LZ77 data\n", path.c_str());
+        return false;
+    }
+
+    unsigned char *reference = LZDecompress(data.data(), data.size(), &expectedSize);
+    if (reference == nullptr)
+    {
+        std::fprintf(stderr, "%s: reference decompression failed\n", path.c_str());
+        return false;
+    }
+
+    std::vector<unsigned char> expected(reference, reference + expectedSize);
+    std::free(reference);
+
+    // The game reads the data as u32s, so give the decoder an aligned copy.
+    std::vector<u32> src((data.size() + 3) / 4, 0);
+    std::memcpy(src.data(), data.data(), data.size());
+
+    std::uniform_int_distribution<u32> randomChunk(1, 0x200);
+    struct
+    {
+        const char *name;
+        long mismatch;
+    } runs[] = {
+        {"in one go", DecodeInChunks(src, expected, [] { return 0xFFFFFFFFu; })},
+        {"a byte at a time", DecodeInChunks(src, expected, [] { return 1u; })},
+        {"in random slices", DecodeInChunks(src, expected, [&] { return randomChunk(rng); })},
+    };
+
+    bool ok = true;
+    for (const auto &run : runs)
+    {
+        if (run.mismatch >= 0)
+        {
+            std::fprintf(stderr, "%s: decoding %s differs at byte 0x%lX\n", path.c_str(), run.name, run.mismatch);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> paths;
+    std::vector<std::string> files;
+    std::mt19937 rng(12345);
+    unsigned failCount = 0;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+            PrintUsage();
+        paths.push_back(argv[i]);
+    }
+    if (paths.empty())
+        paths.push_back("graphics");
+
+    for (const std::string &path : paths)
+        FindLzFiles(path, files);
+
+    if (files.empty())
+        FATAL_ERROR("Error: No .lz files found. Build the graphics first.\n");
+
+    for (const std::string &file : files)
+    {
+        if (!CheckFile(file, rng))
+            failCount++;
+    }
+
+    std::fprintf(stderr, "%zu files checked, %u failed\n", files.size(), failCount);
+    return failCount != 0;
+}
@@ -393,6 +393,8 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
     text << "//\n// DO NOT MODIFY THIS FILE! It is auto-generated from data/maps/map_groups.json\n//\n\n";
 
     int group_num = 0;
+    int map_count = 0;
+    vector<int> group_offsets;
 
     for (auto &group : groups_data["group_order"].array_items()) {
         text << "// Map Group " << group_num << "\n";
@@ -415,10 +417,19 @@ string generate_map_constants_text(string groups_filepath, Json groups_data) {
         }
         text << "\n";
 
+        group_offsets.push_back(map_count);
+        map_count += map_id_num;
         group_num++;
     }
 
-    text << "#define MAP_GROUPS_COUNT " << group_num << "\n\n";
+    text << "#define MAP_GROUPS_COUNT " << group_num << "\n";
+    text << "#define MAPS_COUNT " << map_count << "\n\n";
+
+    text << "// Index of each group's first map when all maps are numbered consecutively.\n";
+    text << "#define MAP_GROUP_OFFSETS {";
+    for (size_t i = 0; i < group_offsets.size(); i++)
+        text << (i == 0 ? " " : ", ") << group_offsets[i];
+    text << " }\n\n";
     text << "#endif // GUARD_CONSTANTS_MAP_GROUPS_H\n";
 
     return text.str();
@@ -18,6 +18,7 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include <cctype>
 #include <cstdio>
 #include <cstdarg>
 #include <stdexcept>
@@ -83,15 +84,18 @@ CFile::CFile(const char * filenameCStr, bool isStdin)
     m_pos = 0;
     m_lineNum = 1;
     m_isStdin = isStdin;
+    m_braceDepth = 0;
 }
 
-CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename))
+CFile::CFile(CFile&& other) : m_filename(std::move(other.m_filename)),
+    m_output(std::move(other.m_output)), m_incbinSymbols(std::move(other.m_incbinSymbols))
 {
     m_buffer = other.m_buffer;
     m_pos = other.m_pos;
     m_size = other.m_size;
     m_lineNum = other.m_lineNum;
     m_isStdin = other.m_isStdin;
+    m_braceDepth = other.m_braceDepth;
 
     other.m_buffer = NULL;
 }
@@ -111,21 +115,21 @@ void CFile::Preproc()
         {
             if (m_buffer[m_pos] == stringChar)
             {
-                std::putchar(stringChar);
+                Output(stringChar);
                 m_pos++;
                 stringChar = 0;
             }
             else if (m_buffer[m_pos] == '\\' && m_buffer[m_pos + 1] == stringChar)
             {
-                std::putchar('\\');
-                std::putchar(stringChar);
+                Output('\\');
+                Output(stringChar);
                 m_pos += 2;
             }
             else
             {
                 if (m_buffer[m_pos] == '\n')
                     m_lineNum++;
-                std::putchar(m_buffer[m_pos]);
+                Output(m_buffer[m_pos]);
                 m_pos++;
             }
         }
@@ -139,7 +143,7 @@ void CFile::Preproc()
 
             char c = m_buffer[m_pos++];
 
-            std::putchar(c);
+            Output(c);
 
             if (c == '\n')
                 m_lineNum++;
@@ -147,8 +151,41 @@ void CFile::Preproc()
                 stringChar = '"';
             else if (c == '\'')
                 stringChar = '\'';
+            else if (c == '{')
+                m_braceDepth++;
+            else if (c == '}')
+                m_braceDepth--;
+
+            // The output is held back one top-level declaration at a time,
+            // so an INCBIN can still rewrite the declaration it's in.
+            if ((c == ';' || c == '}') && m_braceDepth == 0)
+                FlushOutput();
         }
     }
+
+    FlushOutput();
+}
+
+void CFile::Output(char c)
+{
+    m_output += c;
+}
+
+void CFile::OutputFormat(const char* format, ...)
+{
+    char buffer[64];
+    std::va_list args;
+
+    va_start(args, format);
+    std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    m_output += buffer;
+}
+
+void CFile::FlushOutput()
+{
+    std::fwrite(m_output.data(), 1, m_output.size(), stdout);
+    m_output.clear();
 }
 
 bool CFile::ConsumeHorizontalWhitespace()
@@ -168,7 +205,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos += 2;
         m_lineNum++;
-        std::putchar('\n');
+        Output('\n');
         return true;
     }
 
@@ -176,7 +213,7 @@ bool CFile::ConsumeNewline()
     {
         m_pos++;
         m_lineNum++;
-        std::putchar('\n');
+        Output('\n');
         return true;
     }
 
@@ -219,7 +256,7 @@ void CFile::TryConvertString()
 
     SkipWhitespace();
 
-    std::printf("{ ");
+    OutputFormat("{ ");
 
     while (1)
     {
@@ -241,7 +278,7 @@ void CFile::TryConvertString()
             }
 
             for (int i = 0; i < length; i++)
-                printf("0x%02X, ", s[i]);
+                OutputFormat("0x%02X, ", s[i]);
         }
         else if (m_buffer[m_pos] == ')')
         {
@@ -260,9 +297,9 @@ void CFile::TryConvertString()
     }
 
     if (noTerminator)
-        std::printf(" }");
+        OutputFormat(" }");
     else
-        std::printf("0xFF }");
+        OutputFormat("0xFF }");
 }
 
 bool CFile::CheckIdentifier(const std::string& ident)
@@ -354,7 +391,11 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("{");
+    std::size_t dataStart = m_output.size();
+    std::string contents;
+    int pathCount = 0;
+
+    Output('{');
 
     while (true)
     {
@@ -399,15 +440,18 @@ void CFile::TryConvertIncbin()
         int count = fileSize / size;
         int offset = 0;
 
+        if (pathCount++ == 0)
+            contents.assign(reinterpret_cast<char *>(buffer.get()), fileSize);
+
         for (int i = 0; i < count; i++)
         {
             int data = ExtractData(buffer, offset, size);
             offset += size;
 
             if (isSigned)
-                std::printf("%d,", data);
+                OutputFormat("%d,", data);
             else
-                std::printf("%uu,", data);
+                OutputFormat("%uu,", data);
         }
 
         SkipWhitespace();
@@ -423,7 +467,132 @@ void CFile::TryConvertIncbin()
 
     m_pos++;
 
-    std::printf("}");
+    Output('}');
+
+    if (pathCount == 1)
+    {
+        std::string data = m_output.substr(dataStart);
+
+        m_output.resize(dataStart);
+        if (!TryAliasIncbin(contents, size))
+            m_output += data;
+    }
+}
+
+// Checks that the INCBIN being converted is the whole initializer of a
+// file-scope const array declared as NAME[], with nothing else in the
+// declaration, and splits what was output before it.
+bool CFile::ParseIncbinDeclaration(std::size_t& specifierStart, std::string& specifiers, std::string& name, bool& isStatic)
+{
+    long next = m_pos;
+
+    while (next < m_size && (m_buffer[next] == ' ' || m_buffer[next] == '\t' || m_buffer[next] == '\r' || m_buffer[next] == '\n'))
+        next++;
+    if (m_braceDepth != 0 || next >= m_size || m_buffer[next] != ';')
+        return false;
+
+    std::size_t end = m_output.size();
+    const char expected[] = "=][";
+
+    for (int i = 0; i < 3; i++)
+    {
+        while (end > 0 && std::isspace((unsigned char)m_output[end - 1]))
+            end--;
+        if (end == 0 || m_output[end - 1] != expected[i])
+            return false;
+        end--;
+    }
+    while (end > 0 && std::isspace((unsigned char)m_output[end - 1]))
+        end--;
+
+    std::size_t nameStart = end;
+
+    while (nameStart > 0 && IsIdentifierChar(m_output[nameStart - 1]))
+        nameStart--;
+    if (nameStart == end || IsAsciiDigit(m_output[nameStart]))
+        return false;
+    name = m_output.substr(nameStart, end - nameStart);
+
+    // Skip the line markers cpp left since the last declaration.
+    specifierStart = 0;
+    while (specifierStart < nameStart)
+    {
+        if (m_output[specifierStart] == '#' && (specifierStart == 0 || m_output[specifierStart - 1] == '\n'))
+        {
+            while (specifierStart < nameStart && m_output[specifierStart] != '\n')
+                specifierStart++;
+        }
+        else if (std::isspace((unsigned char)m_output[specifierStart]))
+        {
+            specifierStart++;
+        }
+        else
+        {
+            break;
+        }
+    }
+    specifiers = m_output.substr(specifierStart, nameStart - specifierStart);
+
+    bool isConst = false;
+
+    isStatic = false;
+    for (std::size_t i = 0; i < specifiers.size(); )
+    {
+        std::size_t tokenEnd = i;
+
+        while (tokenEnd < specifiers.size() && IsIdentifierChar(specifiers[tokenEnd]))
+            tokenEnd++;
+        if (tokenEnd == i)
+        {
+            if (!std::isspace((unsigned char)specifiers[i]))
+                return false;
+            i++;
+            continue;
+        }
+
+        std::string token = specifiers.substr(i, tokenEnd - i);
+
+        if (token == "extern" || token == "typedef" || token == "volatile" || token == "__attribute__")
+            return false;
+        if (token == "const")
+            isConst = true;
+        else if (token == "static")
+            isStatic = true;
+        i = tokenEnd;
+    }
+    return isConst;
+}
+
+// INCBINs of identical contents in one translation unit share storage. The
+// first becomes the canonical copy, and later ones are declared as aliases
+// of it, so every name still resolves. An alias must be extern for agbcc,
+// so static duplicates keep their own copy, as do ones that would be less
+// aligned than they expect.
+bool CFile::TryAliasIncbin(const std::string& contents, int size)
+{
+    std::size_t specifierStart;
+    std::string specifiers;
+    std::string name;
+    bool isStatic;
+
+    if (contents.empty() || !ParseIncbinDeclaration(specifierStart, specifiers, name, isStatic))
+        return false;
+
+    auto it = m_incbinSymbols.find(contents);
+
+    if (it == m_incbinSymbols.end())
+    {
+        m_incbinSymbols[contents] = { name, size };
+        return false;
+    }
+
+    if (it->second.elementSize < size || isStatic)
+        return false;
+
+    m_output.resize(specifierStart);
+    m_output += "extern " + specifiers + name + "[" + std::to_string(contents.size() / size)
+        + "] __attribute__((alias(\"" + it->second.name + "\")))";
+    return true;
 }
 
 // Reports a diagnostic message.
@@ -23,10 +23,17 @@
 
 #include <cstdarg>
 #include <cstdint>
+#include <map>
 #include <string>
 #include <memory>
 #include "preproc.h"
 
+struct IncbinSymbol
+{
+    std::string name;
+    int elementSize;
+};
+
 class CFile
 {
 public:
@@ -43,6 +50,9 @@ private:
     long m_lineNum;
     std::string m_filename;
     bool m_isStdin;
+    int m_braceDepth;
+    std::string m_output;
+    std::map<std::string, IncbinSymbol> m_incbinSymbols;
 
     bool ConsumeHorizontalWhitespace();
     bool ConsumeNewline();
@@ -51,6 +61,11 @@ private:
     std::unique_ptr<unsigned char[]> ReadWholeFile(const std::string& path, int& size);
     bool CheckIdentifier(const std::string& ident);
     void TryConvertIncbin();
+    bool ParseIncbinDeclaration(std::size_t& specifierStart, std::string& specifiers, std::string& name, bool& isStatic);
+    bool TryAliasIncbin(const std::string& contents, int size);
+    void Output(char c);
+    void OutputFormat(const char* format, ...);
+    void FlushOutput();
     void ReportDiagnostic(const char* type, const char* format, std::va_list args);
     void RaiseError(const char* format, ...);
     void RaiseWarning(const char* format, ...);
@@ -270,3 +270,86 @@ std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, st
 
     return GetCommonSymbols_Shared();
 }
+
+static std::uint32_t GetInt16(const ElfFile &elf, std::uint32_t offset)
+{
+    if (offset + 2 > elf.data.size())
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", s_elfPath.c_str());
+
+    return elf.data[offset] | (elf.data[offset + 1] << 8);
+}
+
+static std::uint32_t GetInt32(const ElfFile &elf, std::uint32_t offset)
+{
+    return GetInt16(elf, offset) | (GetInt16(elf, offset + 2) << 16);
+}
+
+static std::string GetString(const ElfFile &elf, std::uint32_t offset)
+{
+    if (offset >= elf.data.size())
+        FATAL_ERROR("error: unexpected EOF when reading ELF file \"%s\"\n", s_elfPath.c_str());
+
+    const char *s = reinterpret_cast<const char *>(&elf.data[offset]);
+    return std::string(s, strnlen(s, elf.data.size() - offset));
+}
+
+// Unlike GetCommonSymbols, this reads the whole file at once, since the
+// symbol table of a linked ROM is too big to walk a byte at a time.
+void ReadElfFile(std::string path, ElfFile &elf)
+{
+    s_elfPath = path;
+    s_elfFileOffset = 0;
+    s_file = std::fopen(s_elfPath.c_str(), "rb");
+
+    if (s_file == NULL)
+        FATAL_ERROR("error: failed to open \"%s\" for reading\n", path.c_str());
+
+    VerifyElfIdent();
+    std::fseek(s_file, 0, SEEK_END);
+    elf.data.resize(std::ftell(s_file));
+    std::rewind(s_file);
+    if (std::fread(elf.data.data(), 1, elf.data.size(), s_file) != elf.data.size())
+        FATAL_ERROR("error: failed to read \"%s\"\n", path.c_str());
+    std::fclose(s_file);
+
+    std::uint32_t sectionHeaderOffset = GetInt32(elf, 0x20);
+    std::uint32_t sectionHeaderEntrySize = GetInt16(elf, 0x2E);
+    std::uint32_t sectionCount = GetInt16(elf, 0x30);
+    std::uint32_t shstrtabOffset = GetInt32(elf, sectionHeaderOffset + sectionHeaderEntrySize * GetInt16(elf, 0x32) + 0x10);
+    std::uint32_t symtabIndex = 0;
+
+    elf.sections.resize(sectionCount);
+    for (std::uint32_t i = 0; i < sectionCount; i++)
+    {
+        std::uint32_t header = sectionHeaderOffset + sectionHeaderEntrySize * i;
+        ElfSection &section = elf.sections[i];
+
+        section.name = GetString(elf, shstrtabOffset + GetInt32(elf, header));
+        section.type = GetInt32(elf, header + 0x04);
+        section.flags = GetInt32(elf, header + 0x08);
+        section.address = GetInt32(elf, header + 0x0C);
+        section.offset = GetInt32(elf, header + 0x10);
+        section.size = GetInt32(elf, header + 0x14);
+        if (section.name == ".symtab")
+            symtabIndex = i;
+    }
+
+    if (symtabIndex == 0)
+        FATAL_ERROR("error: couldn't find .symtab section in \"%s\"\n", s_elfPath.c_str());
+
+    const ElfSection &symtab = elf.sections[symtabIndex];
+    std::uint32_t strtabOffset = elf.sections[GetInt32(elf, sectionHeaderOffset + sectionHeaderEntrySize * symtabIndex + 0x18)].offset;
+
+    elf.symbols.resize(symtab.size / 16);
+    for (std::uint32_t i = 0; i < elf.symbols.size(); i++)
+    {
+        std::uint32_t entry = symtab.offset + i * 16;
+        ElfSymbol &sym = elf.symbols[i];
+
+        sym.name = GetString(elf, strtabOffset + GetInt32(elf, entry));
+        sym.value = GetInt32(elf, entry + 4);
+        sym.size = GetInt32(elf, entry + 8);
+        sym.sectionIndex = GetInt16(elf, entry + 14);
+        sym.info = elf.data[entry + 12];
+    }
+}
@@ -24,7 +24,49 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
+
+#define SHT_NOBITS 8
+#define SHF_ALLOC  0x2
+
+#define STT_NOTYPE  0
+#define STT_OBJECT  1
+#define STT_FUNC    2
+#define STT_SECTION 3
+#define STT_FILE    4
+
+#define ELF_ST_BIND(info) ((info) >> 4)
+#define ELF_ST_TYPE(info) ((info) & 0xF)
+
+struct ElfSection
+{
+    std::string name;
+    std::uint32_t type;
+    std::uint32_t flags;
+    std::uint32_t address;
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+struct ElfSymbol
+{
+    std::string name;
+    std::uint32_t value;
+    std::uint32_t size;
+    std::uint8_t info;
+    std::uint16_t sectionIndex;
+};
+
+// A whole ELF file read into memory, for tools that need more than the
+// common symbols.
+struct ElfFile
+{
+    std::vector<std::uint8_t> data;
+    std::vector<ElfSection> sections;
+    std::vector<ElfSymbol> symbols;
+};
 
 std::map<std::string, std::uint32_t> GetCommonSymbols(std::string sourcePath, std::string path);
+void ReadElfFile(std::string path, ElfFile &elf);
 
 #endif // ELF_H
@@ -0,0 +1,321 @@
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "romsize.h"
+#include "rom_layout.h"
+
+typedef std::map<std::string, std::uint64_t> SizeTable;
+
+static unsigned s_listCount = 20;
+static unsigned s_minDuplicateSize = 32;
+static unsigned s_assetDepth = 2;
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: romsize [-n COUNT] [-m MIN_SIZE] [-d DEPTH] [-c OLD_ELF] ELF\n"
+        "\n"
+        "Breaks the ROM in ELF down by section, source file, symbol and INCBIN'd\n"
+        "asset directory, and lists byte-identical blobs. With -c, shows what\n"
+        "changed since OLD_ELF instead. Each ELF's linker map is expected next\n"
+        "to it with a .map extension. Run from the repo root, where the sources\n"
+        "are scanned for INCBINs.\n"
+        "\n"
+        "  -n COUNT     entries per list, 0 for all (default 20)\n"
+        "  -m MIN_SIZE  smallest blob checked for duplicates (default 32)\n"
+        "  -d DEPTH     asset directory depth (default 2)\n");
+    std::exit(1);
+}
+
+static std::string GetMapPath(const std::string &elfPath)
+{
+    std::size_t dot = elfPath.rfind('.');
+
+    if (dot != std::string::npos && elfPath.compare(dot, std::string::npos, ".elf") == 0)
+        return elfPath.substr(0, dot) + ".map";
+    return elfPath + ".map";
+}
+
+static std::string GetFileKey(const RomSymbol &symbol)
+{
+    if (!symbol.file.empty())
+        return symbol.file;
+    return symbol.name == "*fill*" ? "*fill*" : "<unknown>";
+}
+
+static std::string GetSectionKey(const RomSymbol &symbol)
+{
+    return symbol.section.empty() ? "*fill*" : symbol.section;
+}
+
+// Static symbols can share a name, so symbols are told apart by file too.
+static std::string GetSymbolKey(const RomSymbol &symbol)
+{
+    if (symbol.name.empty() || symbol.name == "*fill*")
+        return "";
+    return symbol.name + " (" + GetFileKey(symbol) + ")";
+}
+
+// graphics/pokemon/bulbasaur/front.4bpp.lz -> graphics/pokemon
+static std::string GetAssetKey(const RomSymbol &symbol)
+{
+    std::size_t end = 0;
+
+    if (symbol.asset.empty())
+        return "";
+    for (unsigned i = 0; i < s_assetDepth; i++)
+    {
+        std::size_t slash = symbol.asset.find('/', end == 0 ? 0 : end + 1);
+
+        if (slash == std::string::npos)
+            break;
+        end = slash;
+    }
+    return end == 0 ? "." : symbol.asset.substr(0, end);
+}
+
+static SizeTable GetSizes(const RomLayout &layout, std::string (*getKey)(const RomSymbol &))
+{
+    SizeTable sizes;
+
+    for (const RomSymbol &symbol : layout.symbols)
+    {
+        std::string key = getKey(symbol);
+
+        if (!key.empty())
+            sizes[key] += symbol.size;
+    }
+    return sizes;
+}
+
+static double GetPercent(std::uint64_t size, std::uint64_t total)
+{
+    return total == 0 ? 0.0 : size * 100.0 / total;
+}
+
+static void PrintSizes(const char *title, const SizeTable &sizes, std::uint64_t total)
+{
+    std::vector<std::pair<std::string, std::uint64_t>> entries(sizes.begin(), sizes.end());
+    std::size_t count = s_listCount == 0 ? entries.size() : std::min<std::size_t>(s_listCount, entries.size());
+
+    std::sort(entries.begin(), entries.end(), [](const std::pair<std::string, std::uint64_t> &a, const std::pair<std::string, std::uint64_t> &b) {
+        return a.second > b.second;
+    });
+
+    std::printf("\n%s (%zu of %zu)\n", title, count, entries.size());
+    for (std::size_t i = 0; i < count; i++)
+        std::printf("  %9llu %5.1f%%  %s\n", (unsigned long long)entries[i].second,
+                    GetPercent(entries[i].second, total), entries[i].first.c_str());
+}
+
+struct DuplicateGroup
+{
+    std::uint32_t size;
+    std::vector<const RomSymbol *> symbols;
+};
+
+static std::uint64_t HashBytes(const std::uint8_t *data, std::uint32_t size)
+{
+    std::uint64_t hash = 0xCBF29CE484222325;
+
+    for (std::uint32_t i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * 0x100000001B3;
+    return hash;
+}
+
+static std::vector<DuplicateGroup> FindDuplicates(const RomLayout &layout)
+{
+    std::unordered_map<std::uint64_t, std::vector<DuplicateGroup>> buckets;
+    std::vector<DuplicateGroup> duplicates;
+
+    for (const RomSymbol &symbol : layout.symbols)
+    {
+        const std::uint8_t *data = layout.GetData(symbol);
+
+        if (symbol.size < s_minDuplicateSize || GetSymbolKey(symbol).empty() || data == nullptr)
+            continue;
+
+        std::vector<DuplicateGroup> &bucket = buckets[HashBytes(data, symbol.size) ^ symbol.size];
+        bool found = false;
+
+        for (DuplicateGroup &group : bucket)
+        {
+            if (group.size == symbol.size && std::memcmp(layout.GetData(*group.symbols[0]), data, symbol.size) == 0)
+            {
+                group.symbols.push_back(&symbol);
+                found = true;
+                break;
+            }
+        }
+        if (!found)
+            bucket.push_back({symbol.size, {&symbol}});
+    }
+
+    for (auto &bucket : buckets)
+    {
+        for (DuplicateGroup &group : bucket.second)
+        {
+            if (group.symbols.size() > 1)
+                duplicates.push_back(group);
+        }
+    }
+    std::sort(duplicates.begin(), duplicates.end(), [](const DuplicateGroup &a, const DuplicateGroup &b) {
+        std::uint64_t wastedA = (std::uint64_t)a.size * (a.symbols.size() - 1);
+        std::uint64_t wastedB = (std::uint64_t)b.size * (b.symbols.size() - 1);
+        return wastedA != wastedB ? wastedA > wastedB : a.symbols[0]->address < b.symbols[0]->address;
+    });
+    return duplicates;
+}
+
+static void PrintDuplicates(const RomLayout &layout)
+{
+    std::vector<DuplicateGroup> duplicates = FindDuplicates(layout);
+    std::size_t count = s_listCount == 0 ? duplicates.size() : std::min<std::size_t>(s_listCount, duplicates.size());
+    std::uint64_t wasted = 0;
+
+    for (const DuplicateGroup &group : duplicates)
+        wasted += (std::uint64_t)group.size * (group.symbols.size() - 1);
+
+    std::printf("\nDuplicate blobs of %u bytes or more (%zu of %zu, %llu bytes could be shared)\n",
+                s_minDuplicateSize, count, duplicates.size(), (unsigned long long)wasted);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const DuplicateGroup &group = duplicates[i];
+
+        std::printf("  %9u x %zu\n", group.size, group.symbols.size());
+        for (const RomSymbol *symbol : group.symbols)
+            std::printf("      %08X %s%s%s\n", symbol->address, GetSymbolKey(*symbol).c_str(),
+                        symbol->asset.empty() ? "" : " <- ", symbol->asset.c_str());
+    }
+}
+
+static void PrintSharedIncbins(const RomLayout &layout)
+{
+    std::vector<SharedIncbin> shared = layout.sharedIncbins;
+    std::size_t count = s_listCount == 0 ? shared.size() : std::min<std::size_t>(s_listCount, shared.size());
+    std::uint64_t saved = 0;
+
+    for (const SharedIncbin &symbol : shared)
+        saved += symbol.size;
+    std::sort(shared.begin(), shared.end(), [](const SharedIncbin &a, const SharedIncbin &b) {
+        return a.size != b.size ? a.size > b.size : a.address < b.address;
+    });
+
+    std::printf("\nShared INCBINs (%zu of %zu, %llu bytes saved)\n", count, shared.size(), (unsigned long long)saved);
+    for (std::size_t i = 0; i < count; i++)
+        std::printf("  %9u  %08X %s = %s <- %s\n", shared[i].size, shared[i].address, shared[i].name.c_str(),
+                    shared[i].sharedWith.c_str(), shared[i].asset.c_str());
+}
+
+static void PrintReport(const std::string &elfPath, const RomLayout &layout)
+{
+    std::uint64_t total = layout.end - kRomStart;
+    std::uint64_t assets = 0;
+    SizeTable assetSizes = GetSizes(layout, GetAssetKey);
+
+    for (const auto &entry : assetSizes)
+        assets += entry.second;
+
+    std::printf("%s: %llu bytes of ROM (%.1f%% of 32 MiB), %llu from INCBINs\n", elfPath.c_str(),
+                (unsigned long long)total, GetPercent(total, kRomMaxSize), (unsigned long long)assets);
+    PrintSizes("Sections", GetSizes(layout, GetSectionKey), total);
+    PrintSizes("Source files", GetSizes(layout, GetFileKey), total);
+    PrintSizes("Symbols", GetSizes(layout, GetSymbolKey), total);
+    PrintSizes("INCBIN directories", assetSizes, total);
+    PrintSharedIncbins(layout);
+    PrintDuplicates(layout);
+}
+
+static void PrintSizeChanges(const char *title, const SizeTable &oldSizes, const SizeTable &newSizes)
+{
+    std::vector<std::pair<std::string, std::int64_t>> changes;
+    std::size_t count;
+
+    for (const auto &entry : newSizes)
+    {
+        auto it = oldSizes.find(entry.first);
+        std::int64_t oldSize = it == oldSizes.end() ? 0 : it->second;
+
+        if ((std::int64_t)entry.second != oldSize)
+            changes.push_back({entry.first, (std::int64_t)entry.second - oldSize});
+    }
+    for (const auto &entry : oldSizes)
+    {
+        if (newSizes.count(entry.first) == 0)
+            changes.push_back({entry.first, -(std::int64_t)entry.second});
+    }
+
+    std::sort(changes.begin(), changes.end(), [](const std::pair<std::string, std::int64_t> &a, const std::pair<std::string, std::int64_t> &b) {
+        return std::llabs(a.second) > std::llabs(b.second);
+    });
+    count = s_listCount == 0 ? changes.size() : std::min<std::size_t>(s_listCount, changes.size());
+
+    std::printf("\n%s (%zu of %zu changed)\n", title, count, changes.size());
+    for (std::size_t i = 0; i < count; i++)
+    {
+        auto oldIt = oldSizes.find(changes[i].first);
+        auto newIt = newSizes.find(changes[i].first);
+
+        std::printf("  %+9lld  %9s -> %-9s %s\n", (long long)changes[i].second,
+                    oldIt == oldSizes.end() ? "-" : std::to_string(oldIt->second).c_str(),
+                    newIt == newSizes.end() ? "-" : std::to_string(newIt->second).c_str(),
+                    changes[i].first.c_str());
+    }
+}
+
+static void PrintComparison(const std::string &oldPath, const RomLayout &oldLayout, const std::string &newPath, const RomLayout &newLayout)
+{
+    std::int64_t oldTotal = oldLayout.end - kRomStart;
+    std::int64_t newTotal = newLayout.end - kRomStart;
+
+    std::printf("%s -> %s: %lld -> %lld bytes of ROM (%+lld)\n", oldPath.c_str(), newPath.c_str(),
+                (long long)oldTotal, (long long)newTotal, (long long)(newTotal - oldTotal));
+    PrintSizeChanges("Sections", GetSizes(oldLayout, GetSectionKey), GetSizes(newLayout, GetSectionKey));
+    PrintSizeChanges("Source files", GetSizes(oldLayout, GetFileKey), GetSizes(newLayout, GetFileKey));
+    PrintSizeChanges("Symbols", GetSizes(oldLayout, GetSymbolKey), GetSizes(newLayout, GetSymbolKey));
+    PrintSizeChanges("INCBIN directories", GetSizes(oldLayout, GetAssetKey), GetSizes(newLayout, GetAssetKey));
+}
+
+int main(int argc, char **argv)
+{
+    const char *oldPath = nullptr;
+    const char *elfPath = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            s_listCount = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-m") == 0 && i + 1 < argc)
+            s_minDuplicateSize = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+            s_assetDepth = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+            oldPath = argv[++i];
+        else if (elfPath == nullptr && argv[i][0] != '-')
+            elfPath = argv[i];
+        else
+            PrintUsage();
+    }
+
+    if (elfPath == nullptr)
+        PrintUsage();
+
+    std::map<std::string, std::string> incbins = FindIncbinSymbols();
+    RomLayout layout;
+
+    ReadRomLayout(elfPath, GetMapPath(elfPath), incbins, layout);
+    if (oldPath == nullptr)
+    {
+        PrintReport(elfPath, layout);
+        return 0;
+    }
+
+    RomLayout oldLayout;
+
+    ReadRomLayout(oldPath, GetMapPath(oldPath), incbins, oldLayout);
+    PrintComparison(oldPath, oldLayout, elfPath, layout);
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include "romsize.h"
+#include "map_file.h"
+
+static bool ParseHex(const std::string &token, std::uint32_t &value)
+{
+    char *end;
+
+    if (token.compare(0, 2, "0x") != 0)
+        return false;
+    value = std::strtoull(token.c_str() + 2, &end, 16);
+    return *end == 0 && end != token.c_str() + 2;
+}
+
+static std::vector<std::string> SplitLine(const std::string &line)
+{
+    std::istringstream stream(line);
+    std::vector<std::string> tokens;
+    std::string token;
+
+    while (stream >> token)
+        tokens.push_back(token);
+    return tokens;
+}
+
+// Object paths are relative to where ld ran, which is the build directory.
+static std::string NormalizeObjectPath(std::string path)
+{
+    while (path.compare(0, 3, "../") == 0)
+        path.erase(0, 3);
+    return path;
+}
+
+// Input section lines look like
+//   " .text          0x08000204      0x1f4 src/main.o"
+// or, when the section name is too long, have the name on a line of its own
+// with the rest on the next. Output sections start in the first column, and
+// symbol and assignment lines have a single address.
+std::vector<MapInputSection> ReadMapFile(const std::string &path)
+{
+    std::ifstream file(path);
+    std::vector<MapInputSection> sections;
+    std::string outputSection;
+    std::string pendingName;
+    std::string line;
+    bool inMemoryMap = false;
+
+    if (!file.is_open())
+        FATAL_ERROR("Error: Cannot open file \"%s\" for reading.\n", path.c_str());
+
+    while (std::getline(file, line))
+    {
+        if (!inMemoryMap)
+        {
+            inMemoryMap = line.compare(0, 28, "Linker script and memory map") == 0;
+            continue;
+        }
+
+        std::vector<std::string> tokens = SplitLine(line);
+        std::uint32_t address;
+        std::uint32_t size;
+
+        if (tokens.empty())
+            continue;
+
+        if (line[0] != ' ')
+        {
+            outputSection = tokens[0];
+            pendingName.clear();
+            continue;
+        }
+
+        if (tokens.size() == 1 && !ParseHex(tokens[0], address))
+        {
+            pendingName = tokens[0];
+            continue;
+        }
+
+        std::string name = pendingName;
+        std::size_t first = 0;
+
+        pendingName.clear();
+        if (!ParseHex(tokens[0], address))
+        {
+            name = tokens[0];
+            first = 1;
+        }
+
+        if (name.empty() || tokens.size() < first + 2
+         || !ParseHex(tokens[first], address) || !ParseHex(tokens[first + 1], size))
+            continue;
+
+        MapInputSection section;
+
+        section.outputSection = outputSection;
+        section.section = name;
+        section.address = address;
+        section.size = size;
+        if (name == "*fill*")
+            section.object = name;
+        else if (tokens.size() > first + 2)
+            section.object = NormalizeObjectPath(tokens[first + 2]);
+        else
+            continue;
+        sections.push_back(section);
+    }
+
+    if (!inMemoryMap)
+        FATAL_ERROR("Error: \"%s\" is not a GNU ld map file.\n", path.c_str());
+
+    return sections;
+}
@@ -0,0 +1,21 @@
+#ifndef MAP_FILE_H
+#define MAP_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// One input section placed by the linker, as listed in the memory map part
+// of a GNU ld -Map file. Alignment padding is listed as object "*fill*".
+struct MapInputSection
+{
+    std::string outputSection;
+    std::string section;
+    std::string object;
+    std::uint32_t address;
+    std::uint32_t size;
+};
+
+std::vector<MapInputSection> ReadMapFile(const std::string &path);
+
+#endif // MAP_FILE_H
@@ -0,0 +1,348 @@
+#include <algorithm>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iterator>
+#include <sys/stat.h>
+#include "romsize.h"
+#include "map_file.h"
+#include "rom_layout.h"
+
+static bool IsRomSection(const ElfSection &section)
+{
+    return (section.flags & SHF_ALLOC) && section.type != SHT_NOBITS && section.size != 0
+        && section.address >= kRomStart && section.address - kRomStart < kRomMaxSize;
+}
+
+const std::uint8_t *RomLayout::GetData(const RomSymbol &symbol) const
+{
+    for (const ElfSection &section : elf.sections)
+    {
+        if (IsRomSection(section) && symbol.address >= section.address
+         && symbol.address + symbol.size <= section.address + section.size
+         && section.offset + section.size <= elf.data.size())
+            return &elf.data[section.offset + symbol.address - section.address];
+    }
+    return nullptr;
+}
+
+static bool FileExists(const std::string &path)
+{
+    struct stat st;
+    return stat(path.c_str(), &st) == 0 && S_ISREG(st.st_mode);
+}
+
+// src/main.o -> src/main.c, when run from the repo root.
+static std::string GetSourcePath(const std::string &object, std::map<std::string, std::string> &cache)
+{
+    auto it = cache.find(object);
+
+    if (it != cache.end())
+        return it->second;
+
+    std::string path = object;
+
+    if (object.size() > 2 && object.compare(object.size() - 2, 2, ".o") == 0)
+    {
+        std::string base = object.substr(0, object.size() - 2);
+
+        if (FileExists(base + ".c"))
+            path = base + ".c";
+        else if (FileExists(base + ".s"))
+            path = base + ".s";
+    }
+    cache[object] = path;
+    return path;
+}
+
+// The ROM symbols from the ELF in address order, with one entry per
+// address. The others go in aliases. Thumb function addresses have their
+// low bit set.
+static std::vector<ElfSymbol> GetRomSymbols(const ElfFile &elf, std::vector<ElfSymbol> &aliases)
+{
+    std::vector<ElfSymbol> symbols;
+
+    for (ElfSymbol sym : elf.symbols)
+    {
+        int type = ELF_ST_TYPE(sym.info);
+
+        if ((type != STT_NOTYPE && type != STT_OBJECT && type != STT_FUNC)
+         || sym.name.empty() || sym.name[0] == '$' || sym.name[0] == '.'
+         || sym.sectionIndex >= elf.sections.size() || !IsRomSection(elf.sections[sym.sectionIndex]))
+            continue;
+        if (type == STT_FUNC)
+            sym.value &= ~1;
+        symbols.push_back(sym);
+    }
+
+    // Where symbols share an address, keep the one with a size, then the
+    // global one.
+    std::sort(symbols.begin(), symbols.end(), [](const ElfSymbol &a, const ElfSymbol &b) {
+        if (a.value != b.value)
+            return a.value < b.value;
+        if ((a.size != 0) != (b.size != 0))
+            return a.size != 0;
+        return ELF_ST_BIND(a.info) > ELF_ST_BIND(b.info);
+    });
+    std::vector<ElfSymbol> unique;
+
+    for (const ElfSymbol &sym : symbols)
+    {
+        if (!unique.empty() && unique.back().value == sym.value)
+            aliases.push_back(sym);
+        else
+            unique.push_back(sym);
+    }
+    return unique;
+}
+
+void ReadRomLayout(const std::string &elfPath, const std::string &mapPath,
+                   const std::map<std::string, std::string> &incbins, RomLayout &layout)
+{
+    std::vector<MapInputSection> inputSections;
+    std::vector<const ElfSection *> outputSections;
+    std::map<std::string, std::string> sourcePaths;
+
+    ReadElfFile(elfPath, layout.elf);
+    layout.symbols.clear();
+    layout.sharedIncbins.clear();
+    layout.end = kRomStart;
+
+    for (const ElfSection &section : layout.elf.sections)
+    {
+        if (IsRomSection(section))
+        {
+            outputSections.push_back(&section);
+            layout.end = std::max(layout.end, section.address + section.size);
+        }
+    }
+    std::sort(outputSections.begin(), outputSections.end(), [](const ElfSection *a, const ElfSection *b) {
+        return a->address < b->address;
+    });
+
+    for (const MapInputSection &section : ReadMapFile(mapPath))
+    {
+        if (section.size != 0 && section.address >= kRomStart && section.address < layout.end)
+            inputSections.push_back(section);
+    }
+    std::stable_sort(inputSections.begin(), inputSections.end(), [](const MapInputSection &a, const MapInputSection &b) {
+        return a.address < b.address;
+    });
+
+    std::vector<ElfSymbol> aliases;
+    std::vector<ElfSymbol> symbols = GetRomSymbols(layout.elf, aliases);
+    std::size_t nextSymbol = 0;
+    std::size_t nextInput = 0;
+    std::uint32_t address = kRomStart;
+
+    auto add = [&](const std::string &name, const std::string &file, const std::string &section, std::uint32_t end) {
+        if (end > address)
+            layout.symbols.push_back({name, file, section, "", address, end - address});
+        address = std::max(address, end);
+    };
+
+    for (const ElfSection *output : outputSections)
+    {
+        std::uint32_t outputEnd = output->address + output->size;
+
+        add("*fill*", "", "", output->address);
+        while (address < outputEnd)
+        {
+            while (nextInput < inputSections.size() && inputSections[nextInput].address + inputSections[nextInput].size <= address)
+                nextInput++;
+
+            // Bytes the map doesn't account for.
+            if (nextInput == inputSections.size() || inputSections[nextInput].address >= outputEnd)
+            {
+                add("", "", output->name, outputEnd);
+                break;
+            }
+
+            const MapInputSection &input = inputSections[nextInput];
+            std::uint32_t inputEnd = std::min(input.address + input.size, outputEnd);
+            std::string file = input.object == "*fill*" ? "" : GetSourcePath(input.object, sourcePaths);
+
+            add("", "", output->name, input.address);
+            if (input.object == "*fill*")
+            {
+                add("*fill*", "", output->name, inputEnd);
+                continue;
+            }
+
+            while (nextSymbol < symbols.size() && symbols[nextSymbol].value < address)
+                nextSymbol++;
+            while (nextSymbol < symbols.size() && symbols[nextSymbol].value < inputEnd)
+            {
+                const ElfSymbol &sym = symbols[nextSymbol++];
+                std::uint32_t limit = inputEnd;
+
+                if (nextSymbol < symbols.size())
+                    limit = std::min(limit, symbols[nextSymbol].value);
+
+                add("", file, output->name, sym.value);
+                if (sym.size != 0)
+                    add(sym.name, file, output->name, std::min(limit, sym.value + sym.size));
+                else
+                    add(sym.name, file, output->name, limit);
+            }
+            add("", file, output->name, inputEnd);
+        }
+    }
+
+    for (RomSymbol &symbol : layout.symbols)
+    {
+        auto it = incbins.find(symbol.name);
+
+        if (it != incbins.end())
+            symbol.asset = it->second;
+    }
+
+    // INCBINs that preproc made aliases of an identical one.
+    for (const ElfSymbol &alias : aliases)
+    {
+        auto it = incbins.find(alias.name);
+        auto owner = std::lower_bound(layout.symbols.begin(), layout.symbols.end(), alias.value, [](const RomSymbol &symbol, std::uint32_t address) {
+            return symbol.address < address;
+        });
+
+        if (it == incbins.end() || owner == layout.symbols.end() || owner->address != alias.value || owner->asset.empty())
+            continue;
+        layout.sharedIncbins.push_back({alias.name, owner->name, it->second, alias.value, owner->size});
+    }
+}
+
+static bool IsIdentifierChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+static std::string GetQuotedString(const std::string &line, std::size_t pos)
+{
+    std::size_t start = line.find('"', pos);
+    std::size_t end = start == std::string::npos ? start : line.find('"', start + 1);
+
+    if (end == std::string::npos)
+        return "";
+    return line.substr(start + 1, end - start - 1);
+}
+
+// const u32 gFoo[] = INCBIN_U32("graphics/foo.4bpp.lz");
+static void ScanCIncbins(const std::string &line, std::map<std::string, std::string> &symbols)
+{
+    std::size_t incbin = line.find("INCBIN_");
+    std::size_t equals = line.rfind('=', incbin);
+
+    if (incbin == std::string::npos || equals == std::string::npos)
+        return;
+
+    std::size_t end = line.find('[');
+
+    if (end == std::string::npos || end > equals)
+        end = equals;
+    while (end > 0 && line[end - 1] == ' ')
+        end--;
+
+    std::size_t start = end;
+
+    while (start > 0 && IsIdentifierChar(line[start - 1]))
+        start--;
+
+    std::string path = GetQuotedString(line, incbin);
+
+    if (start != end && !path.empty())
+        symbols.emplace(line.substr(start, end - start), path);
+}
+
+// gFoo::
+//     .incbin "graphics/foo.bin"
+static void ScanAsmIncbins(const std::string &line, std::string &label, std::map<std::string, std::string> &symbols)
+{
+    std::size_t end = 0;
+
+    while (end < line.size() && IsIdentifierChar(line[end]))
+        end++;
+    if (end != 0 && end < line.size() && line[end] == ':')
+    {
+        label = line.substr(0, end);
+        return;
+    }
+
+    std::size_t incbin = line.find(".incbin");
+
+    if (incbin != std::string::npos && !label.empty())
+    {
+        std::string path = GetQuotedString(line, incbin);
+
+        if (!path.empty())
+            symbols.emplace(label, path);
+    }
+}
+
+static void ScanDirectory(const std::string &dirPath, std::map<std::string, std::string> &symbols)
+{
+    DIR *dir = opendir(dirPath.c_str());
+    struct dirent *entry;
+
+    if (dir == nullptr)
+        return;
+
+    while ((entry = readdir(dir)) != nullptr)
+    {
+        std::string name = entry->d_name;
+        std::string path = dirPath + "/" + name;
+        std::size_t dot = name.rfind('.');
+        std::string extension = dot == std::string::npos ? "" : name.substr(dot);
+        struct stat st;
+
+        if (name[0] == '.' || stat(path.c_str(), &st) != 0)
+            continue;
+        if (S_ISDIR(st.st_mode))
+        {
+            ScanDirectory(path, symbols);
+            continue;
+        }
+
+        bool isC = extension == ".c" || extension == ".h";
+        bool isAsm = extension == ".s" || extension == ".inc";
+
+        if (!isC && !isAsm)
+            continue;
+
+        std::ifstream file(path, std::ios::binary);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        if (text.find(isC ? "INCBIN_" : ".incbin") == std::string::npos)
+            continue;
+
+        std::string label;
+        std::size_t lineStart = 0;
+
+        while (lineStart < text.size())
+        {
+            std::size_t lineEnd = text.find('\n', lineStart);
+
+            if (lineEnd == std::string::npos)
+                lineEnd = text.size();
+
+            std::string line = text.substr(lineStart, lineEnd - lineStart);
+
+            if (isC)
+                ScanCIncbins(line, symbols);
+            else
+                ScanAsmIncbins(line, label, symbols);
+            lineStart = lineEnd + 1;
+        }
+    }
+    closedir(dir);
+}
+
+std::map<std::string, std::string> FindIncbinSymbols()
+{
+    std::map<std::string, std::string> symbols;
+
+    ScanDirectory("src", symbols);
+    ScanDirectory("gflib", symbols);
+    ScanDirectory("data", symbols);
+    ScanDirectory("sound", symbols);
+    return symbols;
+}
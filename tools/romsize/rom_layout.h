@@ -0,0 +1,55 @@
+#ifndef ROM_LAYOUT_H
+#define ROM_LAYOUT_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "elf.h"
+
+const std::uint32_t kRomStart = 0x08000000;
+const std::uint32_t kRomMaxSize = 0x02000000;
+
+// A run of ROM bytes owned by one symbol. Bytes that no symbol claims get
+// an empty name, and alignment padding is named "*fill*".
+struct RomSymbol
+{
+    std::string name;
+    std::string file;    // source file, object, or archive(member)
+    std::string section; // output section
+    std::string asset;   // file the symbol INCBINs, if any
+    std::uint32_t address;
+    std::uint32_t size;
+};
+
+// Two INCBINs of the same contents that share one copy. Either name can
+// end up as the one the layout lists.
+struct SharedIncbin
+{
+    std::string name;
+    std::string sharedWith;
+    std::string asset;
+    std::uint32_t address;
+    std::uint32_t size;
+};
+
+// Every byte of the ROM from kRomStart to end, split into symbols in
+// address order.
+struct RomLayout
+{
+    ElfFile elf;
+    std::uint32_t end;
+    std::vector<RomSymbol> symbols;
+    std::vector<SharedIncbin> sharedIncbins;
+
+    const std::uint8_t *GetData(const RomSymbol &symbol) const;
+};
+
+// Symbols defined as an INCBIN in src/, gflib/, data/ or sound/, and the
+// file each one includes.
+std::map<std::string, std::string> FindIncbinSymbols();
+
+void ReadRomLayout(const std::string &elfPath, const std::string &mapPath,
+                   const std::map<std::string, std::string> &incbins, RomLayout &layout);
+
+#endif // ROM_LAYOUT_H
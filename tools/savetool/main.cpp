@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "savetool.h"
+#include "save_file.h"
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: savetool check [-j THREADS] SAVE...\n"
+        "       savetool dump SAVE [sb1|sb2|storage]\n"
+        "       savetool diff SAVE SAVE\n"
+        "       savetool migrate SAVE OUTPUT\n");
+    std::exit(1);
+}
+
+struct FieldRange
+{
+    std::string name;
+    unsigned offset;
+    unsigned size;
+};
+
+// The block's listed fields in offset order, with the bytes between them
+// (bitfields, padding, members the table doesn't know about) filled in.
+static std::vector<FieldRange> GetFieldRanges(int blockId)
+{
+    const SaveLayoutBlock &block = gSaveLayoutBlocks[blockId];
+    std::vector<FieldRange> fields;
+    std::vector<FieldRange> ranges;
+    unsigned offset = 0;
+
+    for (unsigned i = 0; i < block.fieldCount; i++)
+        fields.push_back({block.fields[i].name, block.fields[i].offset, block.fields[i].size});
+    std::sort(fields.begin(), fields.end(), [](const FieldRange &a, const FieldRange &b) { return a.offset < b.offset; });
+    fields.push_back({"", block.size, 0});
+
+    for (const FieldRange &field : fields)
+    {
+        if (field.offset > offset)
+        {
+            char name[32];
+            std::snprintf(name, sizeof(name), "<unlisted 0x%X>", offset);
+            ranges.push_back({name, offset, field.offset - offset});
+        }
+        if (field.size != 0)
+            ranges.push_back(field);
+        offset = std::max(offset, field.offset + field.size);
+    }
+    return ranges;
+}
+
+static void PrintSummary(const SaveFile &save)
+{
+    if (!save.IsOpen())
+    {
+        std::printf("%s: %s\n", save.GetPath().c_str(), save.GetError().c_str());
+        return;
+    }
+
+    std::printf("%s: %s, slot %d counter %u", save.GetPath().c_str(), GetSaveStatusName(save.GetStatus()),
+                save.GetCurrentSlot() + 1, save.GetSaveCounter());
+    for (int slot = 0; slot < 2; slot++)
+    {
+        const SlotInfo &info = save.GetSlot(slot);
+        std::printf(" [slot %d: %s%s]", slot + 1, GetSaveStatusName(info.status), info.hasManifest ? ", manifest" : "");
+    }
+    std::printf(" [hof: %s]", GetSaveStatusName(save.GetHallOfFameStatus()));
+    if (save.HasSpecialSection(gSaveSectorIdTrainerHill))
+        std::printf(" [trainer hill]");
+    if (save.HasSpecialSection(gSaveSectorIdRecordedBattle))
+        std::printf(" [recorded battle]");
+    std::printf("\n");
+}
+
+static int HandleCheckCommand(int argc, char **argv)
+{
+    unsigned threadCount = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::string> paths;
+
+    for (int i = 0; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threadCount = std::max(1, std::atoi(argv[++i]));
+        else
+            paths.push_back(argv[i]);
+    }
+
+    if (paths.empty())
+        PrintUsage();
+
+    // Saves are checked on a pool of threads and reported in argument order.
+    std::vector<std::unique_ptr<SaveFile>> saves(paths.size());
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> next(0);
+
+    threadCount = std::min<std::size_t>(threadCount, paths.size());
+    for (unsigned i = 0; i < threadCount; i++)
+    {
+        threads.emplace_back([&]() {
+            std::size_t index;
+            while ((index = next++) < paths.size())
+                saves[index].reset(new SaveFile(paths[index]));
+        });
+    }
+    for (std::thread &thread : threads)
+        thread.join();
+
+    int result = 0;
+    for (const std::unique_ptr<SaveFile> &save : saves)
+    {
+        PrintSummary(*save);
+        if (!save->IsOpen() || save->GetStatus() == SaveStatus::Corrupt)
+            result = 1;
+    }
+    return result;
+}
+
+static int GetBlockIdByName(const char *name)
+{
+    if (std::strcmp(name, "sb2") == 0)
+        return SAVE_BLOCK_2;
+    if (std::strcmp(name, "sb1") == 0)
+        return SAVE_BLOCK_1;
+    if (std::strcmp(name, "storage") == 0)
+        return SAVE_BLOCK_STORAGE;
+    FATAL_ERROR("unknown save block \"%s\"\n", name);
+}
+
+static void OpenSave(std::unique_ptr<SaveFile> &save, const char *path)
+{
+    save.reset(new SaveFile(path));
+    if (!save->IsOpen())
+        FATAL_ERROR("%s: %s\n", path, save->GetError().c_str());
+    if (save->GetStatus() == SaveStatus::Empty || save->GetStatus() == SaveStatus::Corrupt)
+        FATAL_ERROR("%s: save is %s\n", path, GetSaveStatusName(save->GetStatus()));
+}
+
+static int HandleDumpCommand(int argc, char **argv)
+{
+    std::unique_ptr<SaveFile> save;
+    int firstBlock = 0;
+    int lastBlock = SAVE_BLOCK_COUNT - 1;
+
+    if (argc < 1 || argc > 2)
+        PrintUsage();
+    if (argc == 2)
+        firstBlock = lastBlock = GetBlockIdByName(argv[1]);
+
+    OpenSave(save, argv[0]);
+    PrintSummary(*save);
+
+    for (int blockId = firstBlock; blockId <= lastBlock; blockId++)
+    {
+        const std::vector<std::uint8_t> &data = save->GetBlock(blockId);
+
+        std::printf("\n%s (0x%X bytes)\n", gSaveLayoutBlocks[blockId].name, gSaveLayoutBlocks[blockId].size);
+        for (const FieldRange &field : GetFieldRanges(blockId))
+        {
+            std::printf("  %05X %-32s %6u ", field.offset, field.name.c_str(), field.size);
+            for (unsigned i = 0; i < field.size && i < 16; i++)
+                std::printf(" %02X", data[field.offset + i]);
+            if (field.size > 16)
+                std::printf(" ...");
+            std::printf("\n");
+        }
+    }
+    return 0;
+}
+
+static int HandleDiffCommand(int argc, char **argv)
+{
+    std::unique_ptr<SaveFile> a;
+    std::unique_ptr<SaveFile> b;
+    int differences = 0;
+
+    if (argc != 2)
+        PrintUsage();
+
+    OpenSave(a, argv[0]);
+    OpenSave(b, argv[1]);
+
+    for (int blockId = 0; blockId < SAVE_BLOCK_COUNT; blockId++)
+    {
+        const std::vector<std::uint8_t> &dataA = a->GetBlock(blockId);
+        const std::vector<std::uint8_t> &dataB = b->GetBlock(blockId);
+
+        for (const FieldRange &field : GetFieldRanges(blockId))
+        {
+            unsigned first = field.size;
+            unsigned count = 0;
+
+            for (unsigned i = 0; i < field.size; i++)
+            {
+                if (dataA[field.offset + i] != dataB[field.offset + i])
+                {
+                    first = std::min(first, i);
+                    count++;
+                }
+            }
+
+            if (count != 0)
+            {
+                std::printf("%s.%s: %u of %u bytes differ, first at +0x%X (%02X -> %02X)\n",
+                            gSaveLayoutBlocks[blockId].name, field.name.c_str(), count, field.size, first,
+                            dataA[field.offset + first], dataB[field.offset + first]);
+                differences++;
+            }
+        }
+    }
+    return differences != 0;
+}
+
+static int HandleMigrateCommand(int argc, char **argv)
+{
+    std::unique_ptr<SaveFile> save;
+
+    if (argc != 2)
+        PrintUsage();
+
+    OpenSave(save, argv[0]);
+
+    std::vector<std::uint8_t> image = MigrateSave(*save);
+    FILE *fp = std::fopen(argv[1], "wb");
+
+    if (fp == nullptr)
+        FATAL_ERROR("Failed to open \"%s\" for writing.\n", argv[1]);
+    if (std::fwrite(image.data(), 1, image.size(), fp) != image.size())
+        FATAL_ERROR("Failed to write \"%s\".\n", argv[1]);
+    std::fclose(fp);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+        PrintUsage();
+
+    std::string command = argv[1];
+
+    if (command == "check")
+        return HandleCheckCommand(argc - 2, argv + 2);
+    if (command == "dump")
+        return HandleDumpCommand(argc - 2, argv + 2);
+    if (command == "diff")
+        return HandleDiffCommand(argc - 2, argv + 2);
+    if (command == "migrate")
+        return HandleMigrateCommand(argc - 2, argv + 2);
+
+    PrintUsage();
+}
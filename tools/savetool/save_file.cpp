@@ -0,0 +1,302 @@
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "save_file.h"
+
+static std::uint16_t ReadU16(const std::uint8_t *p)
+{
+    return p[0] | (p[1] << 8);
+}
+
+static std::uint32_t ReadU32(const std::uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((std::uint32_t)p[3] << 24);
+}
+
+static void WriteU16(std::uint8_t *p, std::uint16_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+}
+
+static void WriteU32(std::uint8_t *p, std::uint32_t value)
+{
+    p[0] = value;
+    p[1] = value >> 8;
+    p[2] = value >> 16;
+    p[3] = value >> 24;
+}
+
+const char *GetSaveStatusName(SaveStatus status)
+{
+    switch (status)
+    {
+    case SaveStatus::Empty:
+        return "empty";
+    case SaveStatus::Ok:
+        return "ok";
+    case SaveStatus::Corrupt:
+        return "corrupt";
+    case SaveStatus::Error:
+        return "error";
+    }
+    return "?";
+}
+
+SaveFile::SaveFile(const std::string &path)
+    : m_path(path), m_data(nullptr), m_size(0), m_status(SaveStatus::Empty),
+      m_currentSlot(0), m_saveCounter(0), m_hofStatus(SaveStatus::Empty)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat st;
+
+    if (fd < 0)
+    {
+        m_error = "can't open file";
+        return;
+    }
+
+    if (fstat(fd, &st) != 0 || (std::size_t)st.st_size < gSaveSectorSize * gSaveSectorsCount)
+    {
+        m_error = "file is smaller than a flash save";
+        close(fd);
+        return;
+    }
+
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        m_error = "can't map file";
+        return;
+    }
+
+    m_data = static_cast<const std::uint8_t *>(data);
+    m_size = st.st_size;
+    Analyze();
+}
+
+SaveFile::~SaveFile()
+{
+    if (m_data != nullptr)
+        munmap(const_cast<std::uint8_t *>(m_data), m_size);
+}
+
+const std::uint8_t *SaveFile::GetSectorData(unsigned sector) const
+{
+    return m_data + sector * gSaveSectorSize;
+}
+
+bool SaveFile::HasSpecialSection(unsigned sector) const
+{
+    return ReadU32(GetSectorData(sector)) == gSaveSpecialSectionSentinel;
+}
+
+static bool IsManifestValid(const std::uint8_t *manifest)
+{
+    return ReadU32(manifest) == gSaveManifestMagic
+        && ReadU16(manifest + gSaveManifestChecksumOffset) == CalculateSaveChecksum(manifest, gSaveManifestChecksumOffset);
+}
+
+// Same checks as GetSaveSlotStatus in src/save.c.
+SlotInfo SaveFile::AnalyzeSlot(int slot) const
+{
+    SlotInfo info = {SaveStatus::Empty, 0, false, -1};
+    unsigned slotStart = slot * gSaveSlotLength;
+    unsigned slotCheckField = 0;
+    bool securityPassed = false;
+    std::uint32_t manifestCounter = 0;
+    const std::uint8_t *manifest = nullptr;
+    std::vector<std::uint16_t> checksums(gSaveSlotLength);
+
+    for (unsigned i = 0; i < gSaveSlotLength; i++)
+    {
+        const SectorInfo &sector = m_sectors[slotStart + i];
+
+        if (!sector.secure)
+            continue;
+        securityPassed = true;
+        if (!sector.checksumValid)
+            continue;
+
+        info.counter = sector.counter;
+        slotCheckField |= 1 << sector.id;
+        checksums[sector.id] = sector.checksum;
+        if (sector.id == 0)
+        {
+            info.rotation = i;
+            manifest = GetSectorData(slotStart + i) + gSaveSectorDataSize;
+            info.hasManifest = IsManifestValid(manifest);
+            manifestCounter = sector.counter;
+        }
+    }
+
+    if (!securityPassed)
+        return info;
+
+    info.status = SaveStatus::Error;
+    if (slotCheckField != (1u << gSaveSlotLength) - 1)
+        return info;
+
+    if (info.hasManifest)
+    {
+        for (unsigned i = 0; i < gSaveSlotLength; i++)
+        {
+            if (checksums[i] != ReadU16(manifest + gSaveManifestChecksumsOffset + i * 2))
+                return info;
+        }
+        info.counter = manifestCounter;
+    }
+
+    info.status = SaveStatus::Ok;
+    return info;
+}
+
+void SaveFile::Analyze()
+{
+    m_sectors.resize(gSaveSectorsCount);
+    for (unsigned i = 0; i < gSaveSectorsCount; i++)
+    {
+        const std::uint8_t *data = GetSectorData(i);
+        SectorInfo &sector = m_sectors[i];
+
+        sector.id = ReadU16(data + gSaveSectionIdOffset);
+        sector.checksum = ReadU16(data + gSaveSectionChecksumOffset);
+        sector.counter = ReadU32(data + gSaveSectionCounterOffset);
+        sector.secure = ReadU32(data + gSaveSectionSecurityOffset) == gSaveSecurityValue;
+        sector.checksumValid = false;
+        if (i < gSaveSlotLength * 2)
+        {
+            sector.checksumValid = sector.secure && sector.id < gSaveSlotLength
+                && sector.checksum == CalculateSaveChecksum(data, GetSaveSectionSize(sector.id));
+        }
+        else if (i == gSaveSectorIdHof1 || i == gSaveSectorIdHof2)
+        {
+            // Hall of Fame sectors keep their checksum in the ID field.
+            sector.checksumValid = sector.secure && sector.id == CalculateSaveChecksum(data, gSaveSectorDataSize);
+        }
+    }
+
+    m_slots[0] = AnalyzeSlot(0);
+    m_slots[1] = AnalyzeSlot(1);
+
+    // Same choice as GetSaveValidStatus in src/save.c.
+    SaveStatus slot1 = m_slots[0].status;
+    SaveStatus slot2 = m_slots[1].status;
+    std::uint32_t counter1 = m_slots[0].counter;
+    std::uint32_t counter2 = m_slots[1].counter;
+
+    if (slot1 == SaveStatus::Ok && slot2 == SaveStatus::Ok)
+    {
+        if ((counter1 == 0xFFFFFFFF && counter2 == 0) || (counter1 == 0 && counter2 == 0xFFFFFFFF))
+            m_saveCounter = (counter1 + 1 < counter2 + 1) ? counter2 : counter1;
+        else
+            m_saveCounter = (counter1 < counter2) ? counter2 : counter1;
+        m_status = SaveStatus::Ok;
+    }
+    else if (slot1 == SaveStatus::Ok)
+    {
+        m_saveCounter = counter1;
+        m_status = (slot2 == SaveStatus::Error) ? SaveStatus::Error : SaveStatus::Ok;
+    }
+    else if (slot2 == SaveStatus::Ok)
+    {
+        m_saveCounter = counter2;
+        m_status = (slot1 == SaveStatus::Error) ? SaveStatus::Error : SaveStatus::Ok;
+    }
+    else
+    {
+        m_saveCounter = 0;
+        m_status = (slot1 == SaveStatus::Empty && slot2 == SaveStatus::Empty) ? SaveStatus::Empty : SaveStatus::Corrupt;
+    }
+    m_currentSlot = m_saveCounter % 2;
+
+    const SectorInfo &hof1 = m_sectors[gSaveSectorIdHof1];
+    const SectorInfo &hof2 = m_sectors[gSaveSectorIdHof2];
+
+    if (!hof1.secure)
+        m_hofStatus = SaveStatus::Empty;
+    else if (hof1.checksumValid && (!hof2.secure || hof2.checksumValid))
+        m_hofStatus = SaveStatus::Ok;
+    else
+        m_hofStatus = SaveStatus::Corrupt;
+
+    LoadBlocks();
+}
+
+// Same as sub_8152E10 in src/save.c: every good sector of the current slot is
+// copied to its place, whatever the slot's overall status.
+void SaveFile::LoadBlocks()
+{
+    unsigned slotStart = m_currentSlot * gSaveSlotLength;
+
+    for (int i = 0; i < SAVE_BLOCK_COUNT; i++)
+        m_blocks[i].assign(gSaveLayoutBlocks[i].size, 0);
+
+    for (unsigned i = 0; i < gSaveSlotLength; i++)
+    {
+        const SectorInfo &sector = m_sectors[slotStart + i];
+
+        if (!sector.checksumValid)
+            continue;
+
+        for (int j = 0; j < SAVE_BLOCK_COUNT; j++)
+        {
+            const SaveLayoutBlock &block = gSaveLayoutBlocks[j];
+
+            if (sector.id >= block.firstSectorId && sector.id <= block.lastSectorId)
+            {
+                std::memcpy(&m_blocks[j][(sector.id - block.firstSectorId) * gSaveSectorDataSize],
+                            GetSectorData(slotStart + i), GetSaveSectionSize(sector.id));
+            }
+        }
+    }
+}
+
+static void WriteSlot(std::vector<std::uint8_t> &image, const SaveFile &save, int slot, std::uint32_t counter)
+{
+    std::vector<std::uint16_t> checksums(gSaveSlotLength);
+
+    for (unsigned id = 0; id < gSaveSlotLength; id++)
+    {
+        std::uint8_t *sector = &image[(slot * gSaveSlotLength + id) * gSaveSectorSize];
+        unsigned size = GetSaveSectionSize(id);
+
+        std::memset(sector, 0, gSaveSectorSize);
+        for (int j = 0; j < SAVE_BLOCK_COUNT; j++)
+        {
+            const SaveLayoutBlock &block = gSaveLayoutBlocks[j];
+
+            if (id >= block.firstSectorId && id <= block.lastSectorId)
+                std::memcpy(sector, &save.GetBlock(j)[(id - block.firstSectorId) * gSaveSectorDataSize], size);
+        }
+
+        checksums[id] = CalculateSaveChecksum(sector, size);
+        WriteU16(sector + gSaveSectionIdOffset, id);
+        WriteU16(sector + gSaveSectionChecksumOffset, checksums[id]);
+        WriteU32(sector + gSaveSectionSecurityOffset, gSaveSecurityValue);
+        WriteU32(sector + gSaveSectionCounterOffset, counter);
+    }
+
+    std::uint8_t *manifest = &image[slot * gSaveSlotLength * gSaveSectorSize + gSaveSectorDataSize];
+
+    WriteU32(manifest, gSaveManifestMagic);
+    for (unsigned id = 0; id < gSaveSlotLength; id++)
+        WriteU16(manifest + gSaveManifestChecksumsOffset + id * 2, checksums[id]);
+    WriteU16(manifest + gSaveManifestChecksumOffset, CalculateSaveChecksum(manifest, gSaveManifestChecksumOffset));
+}
+
+std::vector<std::uint8_t> MigrateSave(const SaveFile &save)
+{
+    std::vector<std::uint8_t> image(save.GetData(), save.GetData() + save.GetSize());
+    std::uint32_t counter = save.GetSaveCounter();
+
+    // The game loads the slot matching the counter's parity, so the newer
+    // copy has to go in the other slot.
+    WriteSlot(image, save, counter % 2, counter);
+    WriteSlot(image, save, (counter + 1) % 2, counter + 1);
+    return image;
+}
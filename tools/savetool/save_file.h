@@ -0,0 +1,90 @@
+#ifndef SAVE_FILE_H
+#define SAVE_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "save_layout.h"
+
+// Matches SAVE_STATUS_* in include/save.h.
+enum class SaveStatus
+{
+    Empty,
+    Ok,
+    Corrupt,
+    Error,
+};
+
+struct SectorInfo
+{
+    bool secure;        // security word matches
+    bool checksumValid; // secure and the checksum matches the data
+    unsigned id;
+    std::uint16_t checksum;
+    std::uint32_t counter;
+};
+
+struct SlotInfo
+{
+    SaveStatus status;
+    std::uint32_t counter;
+    bool hasManifest;
+    int rotation; // sector holding ID 0, or -1
+};
+
+// A .sav file mapped read-only into memory, with the sector checks the game
+// does on load already run.
+class SaveFile
+{
+public:
+    explicit SaveFile(const std::string &path);
+    ~SaveFile();
+    SaveFile(const SaveFile &) = delete;
+    SaveFile &operator=(const SaveFile &) = delete;
+
+    bool IsOpen() const { return m_data != nullptr; }
+    const std::string &GetError() const { return m_error; }
+    const std::string &GetPath() const { return m_path; }
+
+    SaveStatus GetStatus() const { return m_status; }
+    int GetCurrentSlot() const { return m_currentSlot; }
+    std::uint32_t GetSaveCounter() const { return m_saveCounter; }
+    const SlotInfo &GetSlot(int slot) const { return m_slots[slot]; }
+    const SectorInfo &GetSector(unsigned sector) const { return m_sectors[sector]; }
+    SaveStatus GetHallOfFameStatus() const { return m_hofStatus; }
+    bool HasSpecialSection(unsigned sector) const;
+
+    // The save blocks as the game would load them from the current slot.
+    const std::vector<std::uint8_t> &GetBlock(int block) const { return m_blocks[block]; }
+
+    const std::uint8_t *GetData() const { return m_data; }
+    std::size_t GetSize() const { return m_size; }
+    const std::uint8_t *GetSectorData(unsigned sector) const;
+
+private:
+    void Analyze();
+    SlotInfo AnalyzeSlot(int slot) const;
+    void LoadBlocks();
+
+    std::string m_path;
+    std::string m_error;
+    const std::uint8_t *m_data;
+    std::size_t m_size;
+
+    std::vector<SectorInfo> m_sectors;
+    SlotInfo m_slots[2];
+    SaveStatus m_status;
+    int m_currentSlot;
+    std::uint32_t m_saveCounter;
+    SaveStatus m_hofStatus;
+    std::vector<std::uint8_t> m_blocks[SAVE_BLOCK_COUNT];
+};
+
+const char *GetSaveStatusName(SaveStatus status);
+
+// Rewrites the current slot of a save into both slots in this build's
+// format, with a manifest in sector ID 0. Everything else in the file is
+// copied as is.
+std::vector<std::uint8_t> MigrateSave(const SaveFile &save);
+
+#endif // SAVE_FILE_H
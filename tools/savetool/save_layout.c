@@ -0,0 +1,97 @@
+// Compiled with the host compiler against the game's headers. The save
+// blocks' sizes and field offsets come from save_layout_gba.h, which the
+// Makefile generates with the GBA compiler, so they are the ones the game
+// uses. Only the section footer and manifest, which hold no pointers, are
+// laid out by the host compiler.
+
+#include "global.h"
+#include "pokemon_storage_system.h"
+#include "save.h"
+#include "save_layout.h"
+#include "save_layout_fields.h"
+#include "save_layout_gba.h"
+
+#define STATIC_ASSERT(cond, name) typedef char name[(cond) ? 1 : -1]
+
+#define FIELD(structure, member) { #member, GBA_OFFSETOF_##structure##_##member, GBA_SIZEOF_##structure##_##member },
+
+static const struct SaveLayoutField sSaveBlock2Fields[] =
+{
+    SAVEBLOCK2_FIELDS(FIELD)
+};
+
+static const struct SaveLayoutField sSaveBlock1Fields[] =
+{
+    SAVEBLOCK1_FIELDS(FIELD)
+};
+
+static const struct SaveLayoutField sPokemonStorageFields[] =
+{
+    POKEMON_STORAGE_FIELDS(FIELD)
+};
+
+const struct SaveLayoutBlock gSaveLayoutBlocks[SAVE_BLOCK_COUNT] =
+{
+    [SAVE_BLOCK_2] = {"SaveBlock2", GBA_SIZEOF_SaveBlock2, SECTOR_ID_SAVEBLOCK2, SECTOR_ID_SAVEBLOCK2, sSaveBlock2Fields, ARRAY_COUNT(sSaveBlock2Fields)},
+    [SAVE_BLOCK_1] = {"SaveBlock1", GBA_SIZEOF_SaveBlock1, SECTOR_ID_SAVEBLOCK1_START, SECTOR_ID_SAVEBLOCK1_END, sSaveBlock1Fields, ARRAY_COUNT(sSaveBlock1Fields)},
+    [SAVE_BLOCK_STORAGE] = {"PokemonStorage", GBA_SIZEOF_PokemonStorage, SECTOR_ID_PKMN_STORAGE_START, SECTOR_ID_PKMN_STORAGE_END, sPokemonStorageFields, ARRAY_COUNT(sPokemonStorageFields)},
+};
+
+STATIC_ASSERT(sizeof(struct SaveSection) == 0x1000, SaveSectionSize);
+STATIC_ASSERT(GBA_SIZEOF_SaveBlock2 <= SECTOR_DATA_SIZE, SaveBlock2Size);
+STATIC_ASSERT(GBA_SIZEOF_SaveBlock1 <= SECTOR_DATA_SIZE * (SECTOR_ID_SAVEBLOCK1_END - SECTOR_ID_SAVEBLOCK1_START + 1), SaveBlock1Size);
+STATIC_ASSERT(GBA_SIZEOF_PokemonStorage <= SECTOR_DATA_SIZE * (SECTOR_ID_PKMN_STORAGE_END - SECTOR_ID_PKMN_STORAGE_START + 1), PokemonStorageSize);
+STATIC_ASSERT(SECTOR_DATA_SIZE + sizeof(struct SaveSlotManifest) <= offsetof(struct SaveSection, id), SaveSlotManifestSize);
+
+const unsigned gSaveSectorSize = sizeof(struct SaveSection);
+const unsigned gSaveSectorDataSize = SECTOR_DATA_SIZE;
+const unsigned gSaveSectorsCount = SECTORS_COUNT;
+const unsigned gSaveSlotLength = SECTOR_SAVE_SLOT_LENGTH;
+const unsigned gSaveSectorIdHof1 = SECTOR_ID_HOF_1;
+const unsigned gSaveSectorIdHof2 = SECTOR_ID_HOF_2;
+const unsigned gSaveSectorIdTrainerHill = SECTOR_ID_TRAINER_HILL;
+const unsigned gSaveSectorIdRecordedBattle = SECTOR_ID_RECORDED_BATTLE;
+
+const unsigned gSaveSectionIdOffset = offsetof(struct SaveSection, id);
+const unsigned gSaveSectionChecksumOffset = offsetof(struct SaveSection, checksum);
+const unsigned gSaveSectionSecurityOffset = offsetof(struct SaveSection, security);
+const unsigned gSaveSectionCounterOffset = offsetof(struct SaveSection, counter);
+const unsigned gSaveSecurityValue = UNKNOWN_CHECK_VALUE;
+const unsigned gSaveSpecialSectionSentinel = SPECIAL_SECTION_SENTINEL;
+
+const unsigned gSaveManifestMagic = SAVE_MANIFEST_MAGIC;
+const unsigned gSaveManifestChecksumsOffset = offsetof(struct SaveSlotManifest, checksums);
+const unsigned gSaveManifestChecksumOffset = offsetof(struct SaveSlotManifest, manifestChecksum);
+const unsigned gSaveManifestSize = sizeof(struct SaveSlotManifest);
+
+// Mirrors SAVEBLOCK_CHUNK in src/save.c.
+unsigned GetSaveSectionSize(unsigned sectorId)
+{
+    const struct SaveLayoutBlock *block;
+    unsigned i, chunk;
+
+    for (i = 0; i < SAVE_BLOCK_COUNT; i++)
+    {
+        block = &gSaveLayoutBlocks[i];
+        if (sectorId >= block->firstSectorId && sectorId <= block->lastSectorId)
+        {
+            chunk = sectorId - block->firstSectorId;
+            return min(block->size - chunk * SECTOR_DATA_SIZE, SECTOR_DATA_SIZE);
+        }
+    }
+    return 0;
+}
+
+unsigned short CalculateSaveChecksum(const unsigned char *data, unsigned size)
+{
+    unsigned i;
+    u32 checksum = 0;
+
+    for (i = 0; i < size / 4; i++)
+    {
+        checksum += data[0] | (data[1] << 8) | (data[2] << 16) | ((u32)data[3] << 24);
+        data += sizeof(u32);
+    }
+
+    return ((checksum >> 16) + checksum);
+}
@@ -0,0 +1,69 @@
+#ifndef SAVE_LAYOUT_H
+#define SAVE_LAYOUT_H
+
+// Layout of the save data as the game sees it. save_layout.c is compiled
+// against the game's own headers so this always matches the current build.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct SaveLayoutField
+{
+    const char *name;
+    unsigned offset;
+    unsigned size;
+};
+
+struct SaveLayoutBlock
+{
+    const char *name;
+    unsigned size;
+    unsigned firstSectorId;
+    unsigned lastSectorId;
+    const struct SaveLayoutField *fields;
+    unsigned fieldCount;
+};
+
+enum
+{
+    SAVE_BLOCK_2,
+    SAVE_BLOCK_1,
+    SAVE_BLOCK_STORAGE,
+    SAVE_BLOCK_COUNT
+};
+
+extern const struct SaveLayoutBlock gSaveLayoutBlocks[SAVE_BLOCK_COUNT];
+
+extern const unsigned gSaveSectorSize;
+extern const unsigned gSaveSectorDataSize;
+extern const unsigned gSaveSectorsCount;
+extern const unsigned gSaveSlotLength;
+extern const unsigned gSaveSectorIdHof1;
+extern const unsigned gSaveSectorIdHof2;
+extern const unsigned gSaveSectorIdTrainerHill;
+extern const unsigned gSaveSectorIdRecordedBattle;
+
+extern const unsigned gSaveSectionIdOffset;
+extern const unsigned gSaveSectionChecksumOffset;
+extern const unsigned gSaveSectionSecurityOffset;
+extern const unsigned gSaveSectionCounterOffset;
+extern const unsigned gSaveSecurityValue;
+extern const unsigned gSaveSpecialSectionSentinel;
+
+extern const unsigned gSaveManifestMagic;
+extern const unsigned gSaveManifestChecksumsOffset;
+extern const unsigned gSaveManifestChecksumOffset;
+extern const unsigned gSaveManifestSize;
+
+// Number of save block bytes stored in the sector with the given ID.
+unsigned GetSaveSectionSize(unsigned sectorId);
+
+// Same as CalculateChecksum in src/save.c.
+unsigned short CalculateSaveChecksum(const unsigned char *data, unsigned size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SAVE_LAYOUT_H
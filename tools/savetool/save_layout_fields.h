@@ -0,0 +1,128 @@
+#ifndef SAVE_LAYOUT_FIELDS_H
+#define SAVE_LAYOUT_FIELDS_H
+
+// The save block members savetool knows by name, shared by save_layout.c and
+// save_layout_gba.c. Bitfield members can't be listed here; the tool reports
+// the bytes that hold them (and any member missing from these lists) as
+// unlisted ranges.
+
+#define SAVEBLOCK2_FIELDS(FIELD)                   \
+    FIELD(SaveBlock2, playerName)                  \
+    FIELD(SaveBlock2, playerGender)                \
+    FIELD(SaveBlock2, specialSaveWarpFlags)        \
+    FIELD(SaveBlock2, playerTrainerId)             \
+    FIELD(SaveBlock2, playTimeHours)               \
+    FIELD(SaveBlock2, playTimeMinutes)             \
+    FIELD(SaveBlock2, playTimeSeconds)             \
+    FIELD(SaveBlock2, playTimeVBlanks)             \
+    FIELD(SaveBlock2, pokedex)                     \
+    FIELD(SaveBlock2, localTimeOffset)             \
+    FIELD(SaveBlock2, lastBerryTreeUpdate)         \
+    FIELD(SaveBlock2, encryptionKey)               \
+    FIELD(SaveBlock2, hallRecords1P)               \
+    FIELD(SaveBlock2, hallRecords2P)               \
+    FIELD(SaveBlock2, contestLinkResults)          \
+    FIELD(SaveBlock2, frontier)                    \
+    FIELD(SaveBlock2, achFlags)                    \
+    FIELD(SaveBlock2, achievementPowerFlags)       \
+    FIELD(SaveBlock2, alchemyEffect)               \
+    FIELD(SaveBlock2, alchemyCharges)              \
+    FIELD(SaveBlock2, propertyFlags)               \
+    FIELD(SaveBlock2, propertyRentedFlags)         \
+    FIELD(SaveBlock2, userInterfaceTextboxPalette) \
+    FIELD(SaveBlock2, Deliveries)                  \
+    FIELD(SaveBlock2, DeliveryTimer)               \
+    FIELD(SaveBlock2, gNPCTrainerFactionRelations) \
+    FIELD(SaveBlock2, UIBallSelection)             \
+    FIELD(SaveBlock2, RtcTimeSecondRAW)            \
+    FIELD(SaveBlock2, RtcTimeSecond)               \
+    FIELD(SaveBlock2, SaveStateLastDetection)      \
+    FIELD(SaveBlock2, CompanionParty)              \
+    FIELD(SaveBlock2, RyuPokenavCallSystem)
+
+#define SAVEBLOCK1_FIELDS(FIELD)                     \
+    FIELD(SaveBlock1, pos)                           \
+    FIELD(SaveBlock1, location)                      \
+    FIELD(SaveBlock1, continueGameWarp)              \
+    FIELD(SaveBlock1, dynamicWarp)                   \
+    FIELD(SaveBlock1, lastHealLocation)              \
+    FIELD(SaveBlock1, escapeWarp)                    \
+    FIELD(SaveBlock1, savedMusic)                    \
+    FIELD(SaveBlock1, weather)                       \
+    FIELD(SaveBlock1, weatherCycleStage)             \
+    FIELD(SaveBlock1, flashLevel)                    \
+    FIELD(SaveBlock1, mapLayoutId)                   \
+    FIELD(SaveBlock1, mapView)                       \
+    FIELD(SaveBlock1, playerPartyCount)              \
+    FIELD(SaveBlock1, playerParty)                   \
+    FIELD(SaveBlock1, money)                         \
+    FIELD(SaveBlock1, coins)                         \
+    FIELD(SaveBlock1, registeredItem)                \
+    FIELD(SaveBlock1, pcItems)                       \
+    FIELD(SaveBlock1, bagPocket_Items)               \
+    FIELD(SaveBlock1, bagPocket_Medicine)            \
+    FIELD(SaveBlock1, bagPocket_Collectibles)        \
+    FIELD(SaveBlock1, bagPocket_KeyItems)            \
+    FIELD(SaveBlock1, bagPocket_PokeBalls)           \
+    FIELD(SaveBlock1, bagPocket_TMHM)                \
+    FIELD(SaveBlock1, bagPocket_Berries)             \
+    FIELD(SaveBlock1, bagPocket_MegaStones)          \
+    FIELD(SaveBlock1, pokeblocks)                    \
+    FIELD(SaveBlock1, berryBlenderRecords)           \
+    FIELD(SaveBlock1, objectEvents)                  \
+    FIELD(SaveBlock1, objectEventTemplates)          \
+    FIELD(SaveBlock1, flags)                         \
+    FIELD(SaveBlock1, vars)                          \
+    FIELD(SaveBlock1, gameStats)                     \
+    FIELD(SaveBlock1, berryTrees)                    \
+    FIELD(SaveBlock1, secretBases)                   \
+    FIELD(SaveBlock1, playerRoomDecorations)         \
+    FIELD(SaveBlock1, playerRoomDecorationPositions) \
+    FIELD(SaveBlock1, decorationDesks)               \
+    FIELD(SaveBlock1, decorationChairs)              \
+    FIELD(SaveBlock1, decorationPlants)              \
+    FIELD(SaveBlock1, decorationOrnaments)           \
+    FIELD(SaveBlock1, decorationMats)                \
+    FIELD(SaveBlock1, decorationPosters)             \
+    FIELD(SaveBlock1, decorationDolls)               \
+    FIELD(SaveBlock1, decorationCushions)            \
+    FIELD(SaveBlock1, padding_27CA)                  \
+    FIELD(SaveBlock1, tvShows)                       \
+    FIELD(SaveBlock1, pokeNews)                      \
+    FIELD(SaveBlock1, gabbyAndTyData)                \
+    FIELD(SaveBlock1, easyChatProfile)               \
+    FIELD(SaveBlock1, easyChatBattleStart)           \
+    FIELD(SaveBlock1, easyChatBattleWon)             \
+    FIELD(SaveBlock1, easyChatBattleLost)            \
+    FIELD(SaveBlock1, additionalPhrases)             \
+    FIELD(SaveBlock1, oldMan)                        \
+    FIELD(SaveBlock1, easyChatPairs)                 \
+    FIELD(SaveBlock1, contestWinners)                \
+    FIELD(SaveBlock1, daycare)                       \
+    FIELD(SaveBlock1, linkBattleRecords)             \
+    FIELD(SaveBlock1, giftRibbons)                   \
+    FIELD(SaveBlock1, enigmaBerry)                   \
+    FIELD(SaveBlock1, dexSeen)                       \
+    FIELD(SaveBlock1, dexCaught)                     \
+    FIELD(SaveBlock1, trainerHillTimes)              \
+    FIELD(SaveBlock1, ramScript)                     \
+    FIELD(SaveBlock1, lilycoveLady)                  \
+    FIELD(SaveBlock1, trainerNameRecords)            \
+    FIELD(SaveBlock1, registeredTexts)               \
+    FIELD(SaveBlock1, trainerHill)                   \
+    FIELD(SaveBlock1, waldaPhrase)                   \
+    FIELD(SaveBlock1, dexNavSearchLevels)            \
+    FIELD(SaveBlock1, dexNavChain)                   \
+    FIELD(SaveBlock1, GCMS)                          \
+    FIELD(SaveBlock1, DynamicObjects)                \
+    FIELD(SaveBlock1, dynamicDeliveryIds)            \
+    FIELD(SaveBlock1, challengeFlags)                \
+    FIELD(SaveBlock1, nuzlockeMapsecs)
+
+#define POKEMON_STORAGE_FIELDS(FIELD)    \
+    FIELD(PokemonStorage, currentBox)    \
+    FIELD(PokemonStorage, boxes)         \
+    FIELD(PokemonStorage, boxNames)      \
+    FIELD(PokemonStorage, boxWallpapers)
+
+#endif // SAVE_LAYOUT_FIELDS_H
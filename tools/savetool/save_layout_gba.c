@@ -0,0 +1,28 @@
+// Only ever compiled to assembly, with the GBA compiler. The save blocks hold
+// pointers (object event template scripts, the Enigma Berry's descriptions),
+// so a 64-bit host lays them out differently. Each DEFINE leaves a marker
+// line in the assembly that the Makefile turns into a #define in
+// save_layout_gba.h, which save_layout.c then builds its tables from.
+
+#include "global.h"
+#include "pokemon_storage_system.h"
+#include "save_layout_fields.h"
+
+#define DEFINE(sym, val) asm volatile("\n.ascii \"->" #sym " %0\"" : : "i" (val))
+
+#define BLOCK(structure) DEFINE(GBA_SIZEOF_##structure, sizeof(struct structure))
+
+#define FIELD(structure, member)                                                       \
+    DEFINE(GBA_OFFSETOF_##structure##_##member, offsetof(struct structure, member)); \
+    DEFINE(GBA_SIZEOF_##structure##_##member, sizeof(((struct structure *)0)->member));
+
+void SaveLayoutGba(void)
+{
+    BLOCK(SaveBlock2);
+    BLOCK(SaveBlock1);
+    BLOCK(PokemonStorage);
+
+    SAVEBLOCK2_FIELDS(FIELD)
+    SAVEBLOCK1_FIELDS(FIELD)
+    POKEMON_STORAGE_FIELDS(FIELD)
+}
@@ -0,0 +1,245 @@
+#include <csignal>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "gba/types.h"
+
+extern "C" {
+#include "task.h"
+}
+#include "task_baseline.h"
+
+// One scheduler's entry points, so the same sequence can be replayed on each.
+struct Scheduler
+{
+    const char *name;
+    struct Task *tasks;
+    void (*reset)(void);
+    u8 (*create)(TaskFunc func, u8 priority);
+    void (*destroy)(u8 taskId);
+    void (*run)(void);
+    bool8 (*isActive)(TaskFunc func);
+    u8 (*findId)(TaskFunc func);
+    u8 (*count)(void);
+};
+
+static const Scheduler sCurrent = {
+    "current", gTasks, ResetTasks, CreateTask, DestroyTask, RunTasks,
+    FuncIsActiveTask, FindTaskIdByFunc, GetTaskCount,
+};
+
+static const Scheduler sBaseline = {
+    "baseline", gBaselineTasks, BaselineResetTasks, BaselineCreateTask, BaselineDestroyTask, BaselineRunTasks,
+    BaselineFuncIsActiveTask, BaselineFindTaskIdByFunc, BaselineGetTaskCount,
+};
+
+#define FUNC_COUNT 6
+
+// More task runs than this in one RunTasks means the list has a cycle.
+#define MAX_RUNS_PER_PASS 1000
+
+static const Scheduler *s_scheduler;
+static std::mt19937 s_rng;
+static std::vector<std::string> *s_log;
+static unsigned s_seed;
+static unsigned s_runsThisPass;
+
+static void Log(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+static void Log(const char *format, ...)
+{
+    char buffer[128];
+    va_list args;
+
+    va_start(args, format);
+    std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    s_log->push_back(buffer);
+}
+
+static unsigned Random(unsigned n)
+{
+    return std::uniform_int_distribution<unsigned>(0, n - 1)(s_rng);
+}
+
+// Few distinct priorities, so there are plenty of ties to keep in order.
+static u8 RandomPriority()
+{
+    static const u8 sPriorities[] = {0, 1, 1, 2, 2, 3, 5, 0xFF};
+    return sPriorities[Random(sizeof(sPriorities))];
+}
+
+static void OnTaskRun(int funcIndex, u8 taskId);
+
+template <int N>
+static void Task_Test(u8 taskId)
+{
+    OnTaskRun(N, taskId);
+}
+
+static const TaskFunc sFuncs[FUNC_COUNT] = {
+    Task_Test<0>, Task_Test<1>, Task_Test<2>, Task_Test<3>, Task_Test<4>, Task_Test<5>,
+};
+
+static void CreateRandomTask(const char *where)
+{
+    unsigned funcIndex = Random(FUNC_COUNT);
+    u8 priority = RandomPriority();
+
+    Log("%s: CreateTask(func %u, priority %u) = %u", where, funcIndex, priority, s_scheduler->create(sFuncs[funcIndex], priority));
+}
+
+// Tasks do to the list whatever the game's tasks do: end themselves, end
+// others, start new ones and switch funcs.
+static void OnTaskRun(int funcIndex, u8 taskId)
+{
+    Log("run task %u (func %d)", taskId, funcIndex);
+    if (++s_runsThisPass > MAX_RUNS_PER_PASS)
+    {
+        std::fprintf(stderr, "sequence %u: %s RunTasks never reaches the end of the list\n", s_seed, s_scheduler->name);
+        std::exit(1);
+    }
+
+    switch (Random(10))
+    {
+    case 0:
+    case 1:
+        s_scheduler->destroy(taskId);
+        break;
+    case 2:
+        s_scheduler->destroy(Random(NUM_TASKS));
+        break;
+    case 3:
+        CreateRandomTask("in task");
+        break;
+    case 4:
+        s_scheduler->destroy(taskId);
+        CreateRandomTask("in task");
+        break;
+    case 5:
+        s_scheduler->tasks[taskId].func = sFuncs[Random(FUNC_COUNT)];
+        break;
+    }
+}
+
+static void LogQueries()
+{
+    for (int i = 0; i < FUNC_COUNT; i++)
+    {
+        Log("FindTaskIdByFunc(func %d) = %u, FuncIsActiveTask = %u", i,
+            s_scheduler->findId(sFuncs[i]), s_scheduler->isActive(sFuncs[i]));
+    }
+    Log("GetTaskCount() = %u", s_scheduler->count());
+
+    std::string active;
+    for (int i = 0; i < NUM_TASKS; i++)
+        active += s_scheduler->tasks[i].isActive ? '1' : '0';
+    Log("active slots %s", active.c_str());
+}
+
+// A broken list can also send InsertTask round in circles.
+static void OnTimeout(int)
+{
+    std::fprintf(stderr, "sequence %u: %s scheduler hung\n", s_seed, s_scheduler->name);
+    _exit(1);
+}
+
+static void RunTasksOnce()
+{
+    s_runsThisPass = 0;
+    s_scheduler->run();
+}
+
+static std::vector<std::string> Replay(const Scheduler &scheduler, unsigned seed, unsigned steps)
+{
+    std::vector<std::string> log;
+
+    s_scheduler = &scheduler;
+    alarm(5);
+    s_seed = seed;
+    s_rng.seed(seed);
+    s_log = &log;
+
+    scheduler.reset();
+    for (unsigned step = 0; step < steps; step++)
+    {
+        switch (Random(8))
+        {
+        case 0:
+        case 1:
+            CreateRandomTask("step");
+            break;
+        case 2:
+            scheduler.destroy(Random(NUM_TASKS));
+            break;
+        case 3:
+        case 4:
+        case 5:
+            RunTasksOnce();
+            break;
+        case 6:
+            LogQueries();
+            break;
+        case 7:
+            if (Random(20) == 0)
+                scheduler.reset();
+            else
+                RunTasksOnce();
+            break;
+        }
+    }
+    LogQueries();
+    return log;
+}
+
+int main(int argc, char **argv)
+{
+    unsigned sequences = 2000;
+    unsigned steps = 400;
+    size_t events = 0;
+
+    if (argc > 1)
+        sequences = std::strtoul(argv[1], nullptr, 0);
+    if (argc > 2 || sequences == 0)
+    {
+        std::fprintf(stderr,
+            "USAGE: taskcheck [SEQUENCES]\n"
+            "\n"
+            "Replays random CreateTask/DestroyTask/RunTasks sequences on src/task.c\n"
+            "and on the scheduler it replaced, and checks that tasks run in the same\n"
+            "order and get the same ids, and that FindTaskIdByFunc, FuncIsActiveTask\n"
+            "and GetTaskCount agree.\n");
+        return 1;
+    }
+
+    std::signal(SIGALRM, OnTimeout);
+    for (unsigned seed = 0; seed < sequences; seed++)
+    {
+        std::vector<std::string> expected = Replay(sBaseline, seed, steps);
+        std::vector<std::string> actual = Replay(sCurrent, seed, steps);
+        size_t i;
+
+        for (i = 0; i < expected.size() && i < actual.size(); i++)
+        {
+            if (expected[i] != actual[i])
+                break;
+        }
+
+        if (i != expected.size() || i != actual.size())
+        {
+            std::fprintf(stderr, "sequence %u differs at event %zu:\n  %s: %s\n  %s: %s\n", seed, i,
+                         sBaseline.name, i < expected.size() ? expected[i].c_str() : "(end)",
+                         sCurrent.name, i < actual.size() ? actual[i].c_str() : "(end)");
+            return 1;
+        }
+        events += expected.size();
+    }
+
+    std::fprintf(stderr, "%u sequences, %zu events, all matched\n", sequences, events);
+    return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef TASK_BASELINE_H
+#define TASK_BASELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct Task gBaselineTasks[];
+
+void BaselineResetTasks(void);
+u8 BaselineCreateTask(TaskFunc func, u8 priority);
+void BaselineDestroyTask(u8 taskId);
+void BaselineRunTasks(void);
+bool8 BaselineFuncIsActiveTask(TaskFunc func);
+u8 BaselineFindTaskIdByFunc(TaskFunc func);
+u8 BaselineGetTaskCount(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TASK_BASELINE_H
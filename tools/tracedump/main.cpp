@@ -0,0 +1,212 @@
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include "tracedump.h"
+#include "trace_reader.h"
+
+// TRACE_FRAME in include/constants/trace.h
+const unsigned kFrameEventId = 0;
+
+// GBA clock, and the 64-cycle tick the game records in.
+const double kCyclesPerSecond = 16777216.0;
+const double kCyclesPerTick = 64.0;
+const double kCyclesPerFrame = 280896.0;
+const int kBucketCount = 11; // tenths of the frame budget, then everything over it
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "USAGE: tracedump [-n EVENT_HEADER] [-j CHROME_TRACE_JSON] TRACE\n"
+        "\n"
+        "TRACE is an mGBA log with the output of DumpTraceBuffer, or a memory\n"
+        "dump or uncompressed save state holding the trace buffer.\n"
+        "EVENT_HEADER defaults to include/constants/trace.h.\n");
+    std::exit(1);
+}
+
+static double TicksToMicroseconds(std::uint64_t ticks)
+{
+    return ticks * kCyclesPerTick * 1e6 / kCyclesPerSecond;
+}
+
+static std::string GetEventName(const std::map<unsigned, std::string> &names, unsigned id)
+{
+    auto it = names.find(id);
+
+    if (it != names.end())
+        return it->second;
+    return "EVENT_" + std::to_string(id);
+}
+
+struct OpenSpan
+{
+    unsigned id;
+    std::uint64_t begin;
+};
+
+// Time spent in each event during each complete TRACE_FRAME span. Nested
+// spans of the same event only count once.
+static std::map<unsigned, std::vector<std::uint64_t>> GetFrameTimes(const std::vector<TraceEvent> &events)
+{
+    std::map<unsigned, std::vector<std::uint64_t>> frameTimes;
+    std::map<unsigned, std::uint64_t> frame;
+    std::vector<OpenSpan> stack;
+    bool inFrame = false;
+
+    for (const TraceEvent &event : events)
+    {
+        if (event.phase == kTracePhaseBegin)
+        {
+            if (event.id == kFrameEventId)
+            {
+                stack.clear();
+                frame.clear();
+                inFrame = true;
+            }
+            stack.push_back({event.id, event.timestamp});
+        }
+        else if (event.phase == kTracePhaseEnd)
+        {
+            auto it = std::find_if(stack.rbegin(), stack.rend(), [&](const OpenSpan &span) { return span.id == event.id; });
+
+            // The buffer may start partway through a span.
+            if (it == stack.rend())
+                continue;
+
+            OpenSpan span = *it;
+            stack.erase(std::next(it).base(), stack.end());
+
+            bool nested = std::any_of(stack.begin(), stack.end(), [&](const OpenSpan &open) { return open.id == span.id; });
+
+            if (inFrame && !nested)
+                frame[span.id] += event.timestamp - span.begin;
+
+            if (span.id == kFrameEventId && inFrame)
+            {
+                for (const auto &entry : frame)
+                    frameTimes[entry.first].push_back(entry.second);
+                inFrame = false;
+            }
+        }
+    }
+    return frameTimes;
+}
+
+static void PrintHistograms(const std::vector<TraceEvent> &events, const std::map<unsigned, std::string> &names)
+{
+    std::map<unsigned, std::vector<std::uint64_t>> frameTimes = GetFrameTimes(events);
+
+    std::printf("%zu events, %zu complete frames\n", events.size(),
+                frameTimes.count(kFrameEventId) ? frameTimes[kFrameEventId].size() : (std::size_t)0);
+
+    for (auto &entry : frameTimes)
+    {
+        std::vector<std::uint64_t> &times = entry.second;
+        std::uint64_t total = 0;
+        int buckets[kBucketCount] = {0};
+        int largest = 0;
+
+        std::sort(times.begin(), times.end());
+        for (std::uint64_t ticks : times)
+        {
+            int bucket = std::min<int>(ticks * kCyclesPerTick * 10 / kCyclesPerFrame, kBucketCount - 1);
+
+            total += ticks;
+            buckets[bucket]++;
+            largest = std::max(largest, buckets[bucket]);
+        }
+
+        std::printf("\n%s: %zu frames, mean %.0f us, p50 %.0f us, p95 %.0f us, max %.0f us\n",
+                    GetEventName(names, entry.first).c_str(), times.size(),
+                    TicksToMicroseconds(total) / times.size(),
+                    TicksToMicroseconds(times[times.size() / 2]),
+                    TicksToMicroseconds(times[times.size() * 95 / 100]),
+                    TicksToMicroseconds(times.back()));
+
+        for (int i = 0; i < kBucketCount; i++)
+        {
+            if (buckets[i] == 0)
+                continue;
+
+            int width = (buckets[i] * 40 + largest - 1) / largest;
+            char label[16];
+
+            if (i == kBucketCount - 1)
+                std::snprintf(label, sizeof(label), ">100%%");
+            else
+                std::snprintf(label, sizeof(label), "%d-%d%%", i * 10, i * 10 + 10);
+            std::printf("  %8s %-40s %d\n", label, std::string(width, '#').c_str(), buckets[i]);
+        }
+    }
+}
+
+static void WriteChromeTrace(const std::vector<TraceEvent> &events, const std::map<unsigned, std::string> &names, const char *path)
+{
+    FILE *fp = std::fopen(path, "w");
+
+    if (fp == nullptr)
+        FATAL_ERROR("Error: Cannot open file \"%s\" for writing.\n", path);
+
+    std::fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+        const TraceEvent &event = events[i];
+        const char *phase = event.phase == kTracePhaseBegin ? "B" : event.phase == kTracePhaseEnd ? "E" : "i";
+
+        std::fprintf(fp, "%s\n{\"name\":\"%s\",\"ph\":\"%s\",\"ts\":%.3f,\"pid\":0,\"tid\":0",
+                     i == 0 ? "" : ",", GetEventName(names, event.id).c_str(), phase,
+                     TicksToMicroseconds(events[i].timestamp - events[0].timestamp));
+        if (event.phase == kTracePhaseInstant)
+            std::fprintf(fp, ",\"s\":\"t\"");
+        if (event.argCount != 0)
+        {
+            std::fprintf(fp, ",\"args\":{\"arg0\":\"0x%X\"", event.args[0]);
+            if (event.argCount > 1)
+                std::fprintf(fp, ",\"arg1\":\"0x%X\"", event.args[1]);
+            std::fprintf(fp, "}");
+        }
+        std::fprintf(fp, "}");
+    }
+    std::fprintf(fp, "\n]}\n");
+    std::fclose(fp);
+}
+
+int main(int argc, char **argv)
+{
+    const char *namesPath = "include/constants/trace.h";
+    const char *jsonPath = nullptr;
+    const char *tracePath = nullptr;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "-n") == 0 && i + 1 < argc)
+            namesPath = argv[++i];
+        else if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (tracePath == nullptr && argv[i][0] != '-')
+            tracePath = argv[i];
+        else
+            PrintUsage();
+    }
+
+    if (tracePath == nullptr)
+        PrintUsage();
+
+    std::map<unsigned, std::string> names;
+    FILE *fp = std::fopen(namesPath, "r");
+
+    if (fp != nullptr)
+    {
+        std::fclose(fp);
+        names = ReadTraceEventNames(namesPath);
+    }
+
+    std::vector<TraceEvent> events = ReadTrace(tracePath);
+
+    PrintHistograms(events, names);
+    if (jsonPath != nullptr)
+        WriteChromeTrace(events, names, jsonPath);
+    return 0;
+}
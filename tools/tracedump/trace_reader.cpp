@@ -0,0 +1,144 @@
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <sstream>
+#include "tracedump.h"
+#include "trace_reader.h"
+
+static std::string ReadWholeFile(const std::string &path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+        FATAL_ERROR("Error: Cannot open file \"%s\" for reading.\n", path.c_str());
+
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static std::uint32_t ReadU32(const std::string &data, std::size_t offset)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(data.data() + offset);
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((std::uint32_t)p[3] << 24);
+}
+
+static std::uint16_t ReadU16(const std::string &data, std::size_t offset)
+{
+    const unsigned char *p = reinterpret_cast<const unsigned char *>(data.data() + offset);
+    return p[0] | (p[1] << 8);
+}
+
+// The game's timestamps are 32 bits; give them room to wrap.
+static void UnwrapTimestamps(std::vector<TraceEvent> &events)
+{
+    std::uint64_t base = 0;
+    std::uint32_t last = 0;
+
+    for (TraceEvent &event : events)
+    {
+        std::uint32_t timestamp = (std::uint32_t)event.timestamp;
+
+        if (timestamp < last && last - timestamp > 0x80000000u)
+            base += 0x100000000ull;
+        last = timestamp;
+        event.timestamp = base + timestamp;
+    }
+}
+
+static bool ReadTraceLog(const std::string &data, std::vector<TraceEvent> &events)
+{
+    std::istringstream stream(data);
+    std::string line;
+    bool found = false;
+
+    while (std::getline(stream, line))
+    {
+        std::size_t pos = line.find("TRACE ");
+
+        if (pos == std::string::npos)
+            continue;
+
+        const char *text = line.c_str() + pos + 6;
+
+        if (std::strncmp(text, "BEGIN", 5) == 0)
+        {
+            // A later dump replaces an earlier one.
+            events.clear();
+            found = true;
+            continue;
+        }
+
+        TraceEvent event;
+        unsigned timestamp;
+
+        if (std::sscanf(text, "%x %x %x %x %x %x", &timestamp, &event.id, &event.phase, &event.argCount,
+                        &event.args[0], &event.args[1]) == 6)
+        {
+            event.timestamp = timestamp;
+            events.push_back(event);
+        }
+    }
+    return found;
+}
+
+static bool ReadTraceBuffer(const std::string &data, std::vector<TraceEvent> &events)
+{
+    const std::size_t headerSize = 12;
+    const std::size_t eventSize = 16;
+
+    for (std::size_t offset = 0; offset + headerSize <= data.size(); offset += 4)
+    {
+        if (ReadU32(data, offset) != kTraceBufferMagic || ReadU16(data, offset + 4) != kTraceVersion)
+            continue;
+
+        unsigned size = ReadU16(data, offset + 6);
+        std::uint32_t count = ReadU32(data, offset + 8);
+
+        if (size == 0 || (size & (size - 1)) != 0 || offset + headerSize + size * eventSize > data.size())
+            continue;
+
+        std::uint32_t start = count > size ? count - size : 0;
+
+        for (std::uint32_t i = start; i < count; i++)
+        {
+            std::size_t eventOffset = offset + headerSize + (i & (size - 1)) * eventSize;
+            TraceEvent event;
+
+            event.timestamp = ReadU32(data, eventOffset);
+            event.id = ReadU16(data, eventOffset + 4);
+            event.phase = (unsigned char)data[eventOffset + 6];
+            event.argCount = (unsigned char)data[eventOffset + 7];
+            event.args[0] = ReadU32(data, eventOffset + 8);
+            event.args[1] = ReadU32(data, eventOffset + 12);
+            events.push_back(event);
+        }
+        return true;
+    }
+    return false;
+}
+
+std::vector<TraceEvent> ReadTrace(const std::string &path)
+{
+    std::string data = ReadWholeFile(path);
+    std::vector<TraceEvent> events;
+
+    if (!ReadTraceLog(data, events) && !ReadTraceBuffer(data, events))
+        FATAL_ERROR("Error: No trace found in \"%s\".\n", path.c_str());
+
+    UnwrapTimestamps(events);
+    return events;
+}
+
+std::map<unsigned, std::string> ReadTraceEventNames(const std::string &path)
+{
+    std::string data = ReadWholeFile(path);
+    std::regex define("#define\\s+TRACE_(\\w+)\\s+(\\d+)");
+    std::map<unsigned, std::string> names;
+
+    for (std::sregex_iterator it(data.begin(), data.end(), define), end; it != end; ++it)
+    {
+        if ((*it)[1] != "EVENT_COUNT")
+            names[std::stoul((*it)[2])] = (*it)[1];
+    }
+    return names;
+}
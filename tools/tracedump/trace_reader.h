@@ -0,0 +1,37 @@
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Matches include/trace.h.
+const std::uint32_t kTraceBufferMagic = 0x45435254;
+const unsigned kTraceVersion = 1;
+
+enum TracePhase
+{
+    kTracePhaseInstant,
+    kTracePhaseBegin,
+    kTracePhaseEnd,
+};
+
+struct TraceEvent
+{
+    std::uint64_t timestamp; // units of 64 cycles, unwrapped
+    unsigned id;
+    unsigned phase;
+    unsigned argCount;
+    std::uint32_t args[2];
+};
+
+// Reads the events, oldest first, from either an mGBA log containing the
+// output of DumpTraceBuffer or a binary file holding the trace buffer itself
+// (an EWRAM dump or an uncompressed save state).
+std::vector<TraceEvent> ReadTrace(const std::string &path);
+
+// Reads the TRACE_* event names from include/constants/trace.h.
+std::map<unsigned, std::string> ReadTraceEventNames(const std::string &path);
+
+#endif // TRACE_READER_H